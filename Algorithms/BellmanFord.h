@@ -1,56 +1,37 @@
 #ifndef BELLMANFORD_H
 #define BELLMANFORD_H
 #include "../Utils/Results/PathResult.h"
+#include "../Utils/Representations/GraphView.h"
+#include "../Utils/Representations/AdjacencyList.h"
+#include "../Utils/Representations/AdjancencyMatrix.h"
 
-class BellmanFordList {
+template<GraphView Graph, typename Distance = int>
+class BellmanFord {
 public:
-    static PathResult findShortestPath(const AdjacencyList& graph, int source) {
-        int V = graph.getVertexCount();
-        PathResult result;
-        result.distances = DefinitelyNotAVector<int>(V, INF);
-        result.predecessors = DefinitelyNotAVector<int>(V, -1);
-        result.distances[source] = 0;
+    static constexpr Distance UNREACHABLE = BasicPathResult<Distance>::UNREACHABLE;
 
-        for (int i = 0; i < V - 1; i++) {
-            for (int u = 0; u < V; u++) {
-                for (const auto& edge : graph.getAdjacent(u)) {
-                    int v = edge.destination;
-                    int weight = edge.weight;
-                    if (result.distances[u] != INF && 
-                        result.distances[u] + weight < result.distances[v]) {
-                        result.distances[v] = result.distances[u] + weight;
-                        result.predecessors[v] = u;
-                    }
-                }
-            }
-        }
-        return result;
-    }
-};
-
-class BellmanFordMatrix {
-public:
-    static PathResult findShortestPath(const AdjacencyMatrix& graph, int source) {
+    static BasicPathResult<Distance> findShortestPath(const Graph& graph, int source) {
         int V = graph.getVertexCount();
-        PathResult result;
-        result.distances = DefinitelyNotAVector<int>(V, INF);
+        BasicPathResult<Distance> result;
+        result.distances = DefinitelyNotAVector<Distance>(V, UNREACHABLE);
         result.predecessors = DefinitelyNotAVector<int>(V, -1);
         result.distances[source] = 0;
 
         for (int i = 0; i < V - 1; i++) {
             for (int u = 0; u < V; u++) {
-                for (int v = 0; v < V; v++) {
-                    int weight = graph.getWeight(u, v);
-                    if (weight != graph.getNoEdgeValue() && 
-                        result.distances[u] != INF && 
+                graph.forEachNeighbor(u, [&](int v, int weight) {
+                    if (result.distances[u] != UNREACHABLE && 
                         result.distances[u] + weight < result.distances[v]) {
                         result.distances[v] = result.distances[u] + weight;
                         result.predecessors[v] = u;
                     }
-                }
+                });
             }
         }
         return result;
     }
 };
-#endif //BELLMANFORD_H
\ No newline at end of file
+
+using BellmanFordList = BellmanFord<DirectedAdjacencyList>;
+using BellmanFordMatrix = BellmanFord<DirectedAdjacencyMatrix>;
+#endif //BELLMANFORD_H
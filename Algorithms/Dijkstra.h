@@ -3,56 +3,25 @@
 #include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
 #include "../Utils/Results/PathResult.h"
 #include "../Utils/BinaryHeap.h"
+#include "../Utils/Representations/GraphView.h"
 #include "../Utils/Representations/AdjacencyList.h"
 #include "../Utils/Representations/AdjancencyMatrix.h"
 
 constexpr int INF = std::numeric_limits<int>::max();
 
-class DijkstraList {
+template<GraphView Graph, typename Distance = int>
+class Dijkstra {
 public:
-    static PathResult findShortestPath(const AdjacencyList& graph, int source) {
-        int V = graph.getVertexCount();
-        PathResult result;
-        result.distances = DefinitelyNotAVector<int>(V, INF);
-        result.predecessors = DefinitelyNotAVector<int>(V, -1);
-
-        BinaryHeap<int> minHeap(V);
-        minHeap.insert(0, source, source);
-        result.distances[source] = 0;
-
-        while (!minHeap.empty()) {
-            auto min = minHeap.extractMin();
-            int u = min.vertex;
-
-            for (const auto& edge : graph.getAdjacent(u)) {
-                int v = edge.destination;
-                int weight = edge.weight;
-                if (result.distances[u] != INF &&
-                    result.distances[u] + weight < result.distances[v]) {
-                    result.distances[v] = result.distances[u] + weight;
-                    result.predecessors[v] = u;
+    static constexpr Distance UNREACHABLE = BasicPathResult<Distance>::UNREACHABLE;
 
-                    if (minHeap.contains(v)) {
-                        minHeap.decreaseKey(v, result.distances[v]);
-                    } else {
-                        minHeap.insert(result.distances[v], v, v);
-                    }
-                }
-            }
-        }
-        return result;
-    }
-};
-
-class DijkstraMatrix {
-public:
-    static PathResult findShortestPath(const AdjacencyMatrix& graph, int source) {
+    // Scratch memory (the heap) comes from workspace when given, the result always lives on the heap
+    static BasicPathResult<Distance> findShortestPath(const Graph& graph, int source, AlgorithmWorkspace* workspace = nullptr) {
         int V = graph.getVertexCount();
-        PathResult result;
-        result.distances = DefinitelyNotAVector<int>(V, INF);
+        BasicPathResult<Distance> result;
+        result.distances = DefinitelyNotAVector<Distance>(V, UNREACHABLE);
         result.predecessors = DefinitelyNotAVector<int>(V, -1);
 
-        BinaryHeap<int> minHeap(V);
+        BinaryHeap<Distance> minHeap(V, workspace);
         minHeap.insert(0, source, source);
         result.distances[source] = 0;
 
@@ -60,10 +29,8 @@ public:
             auto min = minHeap.extractMin();
             int u = min.vertex;
 
-            for (int v = 0; v < V; v++) {
-                int weight = graph.getWeight(u, v);
-                if (weight != graph.getNoEdgeValue() &&
-                    result.distances[u] != INF &&
+            graph.forEachNeighbor(u, [&](int v, int weight) {
+                if (result.distances[u] != UNREACHABLE &&
                     result.distances[u] + weight < result.distances[v]) {
                     result.distances[v] = result.distances[u] + weight;
                     result.predecessors[v] = u;
@@ -74,10 +41,13 @@ public:
                         minHeap.insert(result.distances[v], v, v);
                     }
                 }
-            }
+            });
         }
         return result;
     }
 };
 
-#endif //DIJKSTRA_H
\ No newline at end of file
+using DijkstraList = Dijkstra<DirectedAdjacencyList>;
+using DijkstraMatrix = Dijkstra<DirectedAdjacencyMatrix>;
+
+#endif //DIJKSTRA_H
@@ -0,0 +1,160 @@
+#ifndef DIRECTIONOPTIMIZINGBFS_H
+#define DIRECTIONOPTIMIZINGBFS_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotABitset.h"
+#include "../Utils/Parallel/ParallelFor.h"
+
+/**
+ * Direction-optimizing BFS (Beamer et al.) with bitmap frontiers.
+ * Top-down steps expand the frontier through out-arcs, bottom-up steps let every unvisited vertex
+ * look for any parent in the frontier through its in-arcs and stop at the first hit.
+ * The graph is supplied as two callbacks so the same engine serves representations and residual graphs:
+ *   forEachOut(u, visit)  - calls visit(v) for every arc u -> v
+ *   forEachIn(v, visit)   - calls visit(u) for every arc u -> v until visit returns true
+ */
+class DirectionOptimizingBFS {
+public:
+    // Switch to bottom-up when the frontier exceeds unvisited / ALPHA, back to top-down below V / BETA
+    static constexpr int ALPHA = 14;
+    static constexpr int BETA = 24;
+    // A level gets one thread per this many vertices to expand (top-down) or to scan (bottom-up), so small levels
+    // stay on the calling thread - starting a thread costs about as much as expanding a few thousand vertices
+    static constexpr size_t MIN_VERTICES_PER_THREAD = 2048;
+
+    /**
+     * Fills parent (any indexable int array; parent[source] = -1, -1 for unreached vertices) and returns whether target was reached.
+     * Pass target = -1 to traverse the whole reachable part of the graph.
+     */
+    template<typename Parents, typename ForEachOut, typename ForEachIn>
+    static bool run(int V, int source, int target, Parents& parent,
+                    ForEachOut&& forEachOut, ForEachIn&& forEachIn,
+                    int threads = ParallelFor::defaultThreadCount()) {
+        threads = std::max(1, threads);
+
+        for (int v = 0; v < V; v++) {
+            parent[v] = -1;
+        }
+
+        DefinitelyNotABitset visited(V);
+        DefinitelyNotABitset frontier(V);
+        DefinitelyNotABitset next(V);
+        DefinitelyNotAVector<size_t> discoveredPerThread(threads, 0);
+
+        visited.set(source);
+        frontier.set(source);
+        size_t frontierSize = 1;
+        size_t unvisited = V - 1;
+        bool bottomUp = false;
+
+        while (frontierSize > 0) {
+            if (!bottomUp && frontierSize * ALPHA > unvisited) {
+                bottomUp = true;
+            } else if (bottomUp && frontierSize * BETA < static_cast<size_t>(V)) {
+                bottomUp = false;
+            }
+
+            next.clear();
+            for (auto& count : discoveredPerThread) {
+                count = 0;
+            }
+
+            const int levelThreads = threadsFor(bottomUp ? unvisited : frontierSize, threads);
+            if (bottomUp) {
+                ParallelFor::run(V, levelThreads, 64, [&](int t, size_t begin, size_t end) {
+                    discoveredPerThread[t] = bottomUpStep(begin, end, parent, visited, frontier, next, forEachIn);
+                });
+            } else if (levelThreads > 1) {
+                ParallelFor::run(frontier.wordCount(), levelThreads, 1, [&](int t, size_t begin, size_t end) {
+                    discoveredPerThread[t] = topDownStep<true>(begin, end, parent, visited, frontier, next, forEachOut);
+                });
+            } else {
+                discoveredPerThread[0] = topDownStep<false>(0, frontier.wordCount(), parent, visited, frontier, next, forEachOut);
+            }
+
+            frontierSize = 0;
+            for (const auto count : discoveredPerThread) {
+                frontierSize += count;
+            }
+            unvisited -= frontierSize;
+            std::swap(frontier, next);
+
+            if (target != -1 && visited.test(target)) {
+                return true;
+            }
+        }
+
+        return target != -1 && visited.test(target);
+    }
+
+private:
+    static int threadsFor(const size_t vertices, const int threads) {
+        return static_cast<int>(std::clamp<size_t>(vertices / MIN_VERTICES_PER_THREAD, 1, threads));
+    }
+
+    // Expands frontier words [beginWord, endWord); claims are atomic when other threads expand concurrently
+    template<bool Atomic, typename Parents, typename ForEachOut>
+    static size_t topDownStep(size_t beginWord, size_t endWord, Parents& parent,
+                              DefinitelyNotABitset& visited, const DefinitelyNotABitset& frontier,
+                              DefinitelyNotABitset& next, ForEachOut& forEachOut) {
+        size_t discovered = 0;
+
+        for (size_t w = beginWord; w < endWord; w++) {
+            uint64_t bits = frontier.word(w);
+            while (bits != 0) {
+                const int u = static_cast<int>(w * 64 + std::countr_zero(bits));
+                bits &= bits - 1;
+
+                forEachOut(u, [&](int v) {
+                    const uint64_t mask = uint64_t(1) << (v & 63);
+
+                    if constexpr (Atomic) {
+                        std::atomic_ref<uint64_t> visitedWord(visited.word(v >> 6));
+                        if (visitedWord.load(std::memory_order_relaxed) & mask) return;
+                        if (visitedWord.fetch_or(mask, std::memory_order_relaxed) & mask) return;
+                        std::atomic_ref<uint64_t>(next.word(v >> 6)).fetch_or(mask, std::memory_order_relaxed);
+                    } else {
+                        if (visited.word(v >> 6) & mask) return;
+                        visited.word(v >> 6) |= mask;
+                        next.word(v >> 6) |= mask;
+                    }
+
+                    parent[v] = u;
+                    discovered++;
+                });
+            }
+        }
+
+        return discovered;
+    }
+
+    // Every thread owns whole bitmap words of [begin, end), so no synchronization is needed
+    template<typename Parents, typename ForEachIn>
+    static size_t bottomUpStep(size_t begin, size_t end, Parents& parent,
+                               DefinitelyNotABitset& visited, const DefinitelyNotABitset& frontier,
+                               DefinitelyNotABitset& next, ForEachIn& forEachIn) {
+        size_t discovered = 0;
+
+        for (size_t v = begin; v < end; v++) {
+            if (visited.test(v)) continue;
+
+            forEachIn(static_cast<int>(v), [&](int u) {
+                if (!frontier.test(u)) return false;
+
+                parent[v] = u;
+                visited.set(v);
+                next.set(v);
+                discovered++;
+                return true;
+            });
+        }
+
+        return discovered;
+    }
+};
+
+#endif //DIRECTIONOPTIMIZINGBFS_H
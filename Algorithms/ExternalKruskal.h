@@ -0,0 +1,271 @@
+#ifndef EXTERNALKRUSKAL_H
+#define EXTERNALKRUSKAL_H
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "../Utils/DefinitelyNotADataStructures/UnionFind.h"
+#include "../Utils/Results/MSTResult.h"
+#include "../Utils/Representations/Edge.h"
+#include "../Infrastructure/IntegerScanner.h"
+#include "../Infrastructure/MappedFile.h"
+
+/**
+ * Out-of-core Kruskal for edge files larger than memory.
+ * The edge file (MST input format: "E V" header, then "u v w" lines) is read in chunks that fit the memory budget,
+ * every chunk is sorted and written as a binary run, and a k-way merge of the runs feeds the union-find.
+ * Only the run buffers and the O(V) union-find live in memory. Edges are ordered as in KruskalAlgorithm on the
+ * same GraphData - by weight, then source, then destination - so both produce the same MSTResult.
+ */
+template<typename Total = int>
+class ExternalKruskal {
+public:
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = size_t(256) << 20;
+    // Smallest read buffer of one run during a merge, the merge fan-in follows from it
+    static constexpr size_t MIN_RUN_BUFFER = size_t(64) << 10;
+
+    static BasicMSTResult<Total> findMST(const std::string& fileName, size_t memoryBudget = DEFAULT_MEMORY_BUDGET,
+                                         const std::filesystem::path& runDirectory = std::filesystem::temp_directory_path()) {
+        // Mapped, so only the pages being parsed are resident however large the file is
+        const MappedFile file(fileName);
+        IntegerScanner scanner(file.data(), file.data() + file.size());
+
+        long long numEdges = 0;
+        int numVertices = 0;
+        if (!scanner.next(numEdges) || !scanner.next(numVertices) || numEdges < 0 || numVertices < 0) {
+            throw std::invalid_argument("Number of vertices and edges must be non-negative");
+        }
+
+        memoryBudget = std::max(memoryBudget, 2 * MIN_RUN_BUFFER);
+        const size_t runCapacity = memoryBudget / sizeof(Edge);
+
+        RunFiles runs(runDirectory);
+        DefinitelyNotAVector<Edge> buffer;
+        buffer.reserve(static_cast<size_t>(std::min<long long>(numEdges, static_cast<long long>(runCapacity))));
+
+        for (long long i = 0; i < numEdges; i++) {
+            int start, end, weight;
+            if (!scanner.next(start) || !scanner.next(end) || !scanner.next(weight)) {
+                throw std::runtime_error("Edge file ended after " + std::to_string(i) + " of " + std::to_string(numEdges) + " edges");
+            }
+            if (start < 0 || start >= numVertices || end < 0 || end >= numVertices) {
+                throw std::invalid_argument("Invalid vertex number detected");
+            }
+
+            buffer.emplace_back(start, end, weight);
+            if (buffer.size() == runCapacity) {
+                std::sort(buffer.begin(), buffer.end(), lessEdge);
+                writeRun(buffer.begin(), buffer.size(), runs.create());
+                buffer.clear();
+            }
+        }
+
+        BasicMSTResult<Total> result;
+        UnionFind uf(numVertices);
+        const size_t treeSize = numVertices > 0 ? static_cast<size_t>(numVertices - 1) : 0;
+
+        auto unite = [&](const Edge& edge) {
+            if (uf.find(edge.source) != uf.find(edge.destination)) {
+                uf.unite(edge.source, edge.destination);
+                result.edges.emplace_back(edge.source, edge.destination, edge.weight);
+                result.totalWeight += edge.weight;
+            }
+            // The tree is complete once it spans every vertex, the rest of the runs is never read
+            return result.edges.size() < treeSize;
+        };
+
+        std::sort(buffer.begin(), buffer.end(), lessEdge);
+
+        // Everything fit into one buffer - no disk round trip
+        if (runs.size() == 0) {
+            for (const auto& edge : buffer) {
+                if (!unite(edge)) break;
+            }
+            return result;
+        }
+
+        if (!buffer.empty()) {
+            writeRun(buffer.begin(), buffer.size(), runs.create());
+        }
+        buffer = DefinitelyNotAVector<Edge>();
+
+        // Merge passes until every run gets a large enough read buffer in the final merge
+        const size_t maxFanIn = std::max<size_t>(2, memoryBudget / MIN_RUN_BUFFER - 1);
+        size_t first = 0;
+        while (runs.size() - first > maxFanIn) {
+            const size_t last = first + maxFanIn;
+            RunWriter writer(runs.create(), memoryBudget / (maxFanIn + 1) / sizeof(Edge));
+            merge(runs, first, last, memoryBudget, [&writer](const Edge& edge) {
+                writer.write(edge);
+                return true;
+            });
+            writer.finish();
+            runs.remove(first, last);
+            first = last;
+        }
+
+        merge(runs, first, runs.size(), memoryBudget, unite);
+        return result;
+    }
+
+private:
+    static bool lessEdge(const Edge& a, const Edge& b) {
+        if (a.weight != b.weight) return a.weight < b.weight;
+        if (a.source != b.source) return a.source < b.source;
+        return a.destination < b.destination;
+    }
+
+    // Owns the run files and deletes whatever is left of them, also when the merge throws
+    class RunFiles {
+    private:
+        std::filesystem::path directory;
+        std::string prefix;
+        DefinitelyNotAVector<std::filesystem::path> paths;
+
+    public:
+        explicit RunFiles(std::filesystem::path directory)
+            : directory(std::move(directory)), prefix("kruskal-run-" + std::to_string(std::random_device()()) + "-") {}
+
+        ~RunFiles() {
+            std::error_code ignored;
+            for (const auto& path : paths) {
+                if (!path.empty()) std::filesystem::remove(path, ignored);
+            }
+        }
+
+        RunFiles(const RunFiles&) = delete;
+        RunFiles& operator=(const RunFiles&) = delete;
+
+        const std::filesystem::path& create() {
+            paths.push_back(directory / (prefix + std::to_string(paths.size()) + ".bin"));
+            return paths.back();
+        }
+
+        void remove(size_t first, size_t last) {
+            std::error_code ignored;
+            for (size_t i = first; i < last; i++) {
+                std::filesystem::remove(paths[i], ignored);
+                paths[i].clear();
+            }
+        }
+
+        [[nodiscard]] size_t size() const { return paths.size(); }
+        const std::filesystem::path& operator[](size_t index) const { return paths[index]; }
+    };
+
+    static void writeRun(const Edge* edges, size_t count, const std::filesystem::path& path) {
+        std::ofstream out(path, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(edges), static_cast<std::streamsize>(count * sizeof(Edge)));
+        if (!out) {
+            throw std::runtime_error("Could not write run file: " + path.string());
+        }
+    }
+
+    class RunWriter {
+    private:
+        std::ofstream out;
+        DefinitelyNotAVector<Edge> buffer;
+        std::filesystem::path path;
+
+    public:
+        RunWriter(const std::filesystem::path& path, size_t bufferRecords) : out(path, std::ios::binary), path(path) {
+            buffer.reserve(std::max<size_t>(bufferRecords, 1));
+        }
+
+        void write(const Edge& edge) {
+            buffer.push_back(edge);
+            if (buffer.size() == buffer.capacity()) flush();
+        }
+
+        void flush() {
+            out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size() * sizeof(Edge)));
+            buffer.clear();
+            if (!out) {
+                throw std::runtime_error("Could not write run file: " + path.string());
+            }
+        }
+
+        void finish() {
+            flush();
+            out.close();
+        }
+    };
+
+    class RunReader {
+    private:
+        std::ifstream in;
+        DefinitelyNotAVector<Edge> buffer;
+        size_t filled = 0;
+        size_t position = 0;
+
+    public:
+        RunReader(const std::filesystem::path& path, size_t bufferRecords)
+            : in(path, std::ios::binary), buffer(std::max<size_t>(bufferRecords, 1)) {
+            if (!in.is_open()) {
+                throw std::runtime_error("Could not open run file: " + path.string());
+            }
+        }
+
+        bool next(Edge& edge) {
+            if (position == filled) {
+                in.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size() * sizeof(Edge)));
+                filled = static_cast<size_t>(in.gcount()) / sizeof(Edge);
+                position = 0;
+                if (filled == 0) return false;
+            }
+            edge = buffer[position++];
+            return true;
+        }
+    };
+
+    struct HeapEntry {
+        Edge edge;
+        size_t run;
+    };
+
+    // Merges runs [first, last) in edge order into sink, which returns false to stop early
+    template<typename Sink>
+    static void merge(const RunFiles& runs, size_t first, size_t last, size_t memoryBudget, Sink&& sink) {
+        const size_t count = last - first;
+        const size_t bufferRecords = memoryBudget / (count + 1) / sizeof(Edge);
+
+        DefinitelyNotAVector<RunReader> readers;
+        readers.reserve(count);
+        DefinitelyNotAVector<HeapEntry> heap;
+        heap.reserve(count);
+
+        // Min-heap on edge order, ties between equal edges of different runs broken by run
+        auto greater = [](const HeapEntry& a, const HeapEntry& b) {
+            if (lessEdge(b.edge, a.edge)) return true;
+            if (lessEdge(a.edge, b.edge)) return false;
+            return a.run > b.run;
+        };
+
+        for (size_t i = 0; i < count; i++) {
+            auto& reader = readers.emplace_back(runs[first + i], bufferRecords);
+            Edge edge;
+            if (reader.next(edge)) {
+                heap.push_back(HeapEntry{edge, i});
+            }
+        }
+        std::make_heap(heap.begin(), heap.end(), greater);
+
+        while (!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), greater);
+            HeapEntry& top = heap.back();
+            if (!sink(top.edge)) return;
+
+            if (readers[top.run].next(top.edge)) {
+                std::push_heap(heap.begin(), heap.end(), greater);
+            } else {
+                heap.pop_back();
+            }
+        }
+    }
+};
+
+#endif //EXTERNALKRUSKAL_H
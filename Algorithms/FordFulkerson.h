@@ -1,189 +1,184 @@
 #ifndef FORDFULKERSON_H
 #define FORDFULKERSON_H
 #include "../Utils/Results/FlowResult.h"
-#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAQueue.h"
 #include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "../Utils/Memory/AlgorithmWorkspace.h"
 #include "../Utils/Enums/SearchMethod.h"
+#include "../Utils/Enums/FlowOutputMode.h"
+#include "../Utils/Representations/GraphView.h"
+#include "../Utils/Representations/AdjacencyList.h"
+#include "../Utils/Representations/AdjancencyMatrix.h"
+#include "DirectionOptimizingBFS.h"
+#include "MinCut.h"
 
 
-class FordFulkersonList {
+// Capacity accumulates the flow value, single arcs keep int residual capacities
+template<GraphView Graph, typename Capacity = int>
+class FordFulkerson {
+private:
+    using ResidualGraph = ScratchVector<ScratchVector<int>>;
+
 public:
-    static FlowResult findMaxFlow(const AdjacencyList& graph, int source, int sink, SearchMethod method = SearchMethod::BFS) {
+    // Scratch memory (residual graph, search arrays) comes from workspace when given, the result always lives on the heap.
+    // threads only splits the levels of direction-optimizing BFS - callers that already run flows in parallel pass 1
+    static BasicFlowResult<Capacity> findMaxFlow(const Graph& graph, int source, int sink, SearchMethod method = SearchMethod::BFS,
+                                  FlowOutputMode output = FlowOutputMode::DENSE, AlgorithmWorkspace* workspace = nullptr,
+                                  int threads = ParallelFor::defaultThreadCount()) {
         int V = graph.getVertexCount();
-        FlowResult result;
+        BasicFlowResult<Capacity> result;
         result.maxFlow = 0;
-        result.flowGraph = DefinitelyNotAVector<DefinitelyNotAVector<int>>(V);
-        result.residualGraph = DefinitelyNotAVector<DefinitelyNotAVector<int>>(V);
-        
-        // Initialize graphs with zero vectors
+        result.output = output;
+
+        // Flows are not tracked during augmentation - they follow from capacity - residual at the end
+        const WorkspaceAllocator<int> scratch(workspace);
+        ResidualGraph residualGraph{WorkspaceAllocator<ScratchVector<int>>(workspace)};
+        residualGraph.reserve(V);
         for (int i = 0; i < V; i++) {
-            result.flowGraph[i] = DefinitelyNotAVector<int>(V, 0);
-            result.residualGraph[i] = DefinitelyNotAVector<int>(V, 0);
+            residualGraph.emplace_back(V, 0, scratch);
         }
 
-        // Initialize residual graph
+        // Initialize residual graph - parallel arcs add up to one residual arc
         for (int u = 0; u < V; u++) {
-            for (const auto& edge : graph.getAdjacent(u)) {
-                result.residualGraph[u][edge.destination] = edge.weight;
-            }
+            graph.forEachNeighbor(u, [&](int v, int weight) {
+                residualGraph[u][v] += weight;
+            });
         }
 
-        DefinitelyNotAVector<int> parent(V);
+        // Allocated once and reused by every search, so a run draws a fixed amount of scratch memory
+        ScratchVector<int> parent(V, scratch);
+        ScratchVector<bool> visited(V, false, WorkspaceAllocator<bool>(workspace));
+        ScratchVector<int> queue(V, scratch);
         bool pathFound = false;
-        
-        while (true) {
-            // Choose search method based on parameter
-            if (method == SearchMethod::BFS) {
-                pathFound = bfs(result.residualGraph, source, sink, parent, V);
-            } else {
-                DefinitelyNotAVector<bool> visited(V, false);
-                pathFound = dfs(result.residualGraph, source, sink, parent, visited, V);
-            }
-            
-            if (!pathFound) break;
-            
-            int pathFlow = INT_MAX;
-            for (int v = sink; v != source; v = parent[v]) {
-                int u = parent[v];
-                pathFlow = std::min(pathFlow, result.residualGraph[u][v]);
-            }
 
-            for (int v = sink; v != source; v = parent[v]) {
-                int u = parent[v];
-                result.flowGraph[u][v] += pathFlow;
-                result.flowGraph[v][u] -= pathFlow;
-                result.residualGraph[u][v] -= pathFlow;
-                result.residualGraph[v][u] += pathFlow;
-            }
+        // Capacity scaling only augments along arcs with residual >= delta and halves delta each phase,
+        // the other methods run a single phase with delta = 1
+        int delta = method == SearchMethod::CAPACITY_SCALING ? initialDelta(residualGraph, V) : 1;
+
+        while (delta >= 1) {
+            while (true) {
+                // Choose search method based on parameter
+                if (method == SearchMethod::BFS || method == SearchMethod::CAPACITY_SCALING) {
+                    pathFound = bfs(residualGraph, source, sink, parent, visited, queue, V, delta);
+                } else if (method == SearchMethod::DIRECTION_OPTIMIZING_BFS) {
+                    pathFound = directionOptimizingBfs(residualGraph, source, sink, parent, V, threads);
+                } else {
+                    std::fill(visited.begin(), visited.end(), false);
+                    pathFound = dfs(residualGraph, source, sink, parent, visited, V);
+                }
 
-            result.maxFlow += pathFlow;
-        }
+                if (!pathFound) break;
 
-        return result;
-    }
-
-private:
-    static bool bfs(const DefinitelyNotAVector<DefinitelyNotAVector<int>>& rGraph, 
-                   int s, int t, DefinitelyNotAVector<int>& parent, int V) {
-        DefinitelyNotAVector<bool> visited(V, false);
-        DefinitelyNotAQueue<int> queue;
-        queue.push(s);
-        visited[s] = true;
-        parent[s] = -1;
-
-        while (!queue.empty()) {
-            int u = queue.front();
-            queue.pop();
+                int pathFlow = INT_MAX;
+                for (int v = sink; v != source; v = parent[v]) {
+                    int u = parent[v];
+                    pathFlow = std::min(pathFlow, residualGraph[u][v]);
+                }
 
-            for (int v = 0; v < V; v++) {
-                if (!visited[v] && rGraph[u][v] > 0) {
-                    queue.push(v);
-                    parent[v] = u;
-                    visited[v] = true;
+                for (int v = sink; v != source; v = parent[v]) {
+                    int u = parent[v];
+                    residualGraph[u][v] -= pathFlow;
+                    residualGraph[v][u] += pathFlow;
                 }
+
+                result.maxFlow += pathFlow;
             }
+
+            delta /= 2;
         }
 
-        return visited[t];
+        storeOutput(result, graph, residualGraph, source);
+        return result;
     }
-    
-    static bool dfs(const DefinitelyNotAVector<DefinitelyNotAVector<int>>& rGraph,
-                    int u, int t, DefinitelyNotAVector<int>& parent, 
-                    DefinitelyNotAVector<bool>& visited, int V) {
-        if (u == t) {
-            return true;
+
+private:
+    // Fills only the form of flow output that was requested
+    static void storeOutput(BasicFlowResult<Capacity>& result, const Graph& graph,
+                            const ResidualGraph& residualGraph, int source) {
+        if (result.output == FlowOutputMode::VALUE_ONLY) return;
+
+        const int V = graph.getVertexCount();
+        if (result.output == FlowOutputMode::CUT_ONLY) {
+            result.sourceSide = MinCut::findSourceSide(residualGraph, source, V);
+            return;
         }
-        
-        visited[u] = true;
-        
-        for (int v = 0; v < V; v++) {
-            if (!visited[v] && rGraph[u][v] > 0) {
-                parent[v] = u;
-                if (dfs(rGraph, v, t, parent, visited, V)) {
-                    return true;
-                }
+        MinCut::extract(result, graph, residualGraph, source);
+
+        if (result.output == FlowOutputMode::SPARSE) {
+            // The flow of a residual arc is handed out to its parallel input arcs in adjacency order,
+            // each taking at most its own capacity
+            DefinitelyNotAVector<int> pairCapacity(V, 0);
+            DefinitelyNotAVector<int> flowLeft(V, 0);
+            for (int u = 0; u < V; u++) {
+                graph.forEachNeighbor(u, [&](int v, int weight) {
+                    pairCapacity[v] += weight;
+                });
+                graph.forEachNeighbor(u, [&](int v, int weight) {
+                    if (pairCapacity[v] > 0) {
+                        flowLeft[v] = std::max(0, pairCapacity[v] - residualGraph[u][v]);
+                        pairCapacity[v] = 0;
+                    }
+                    const int flow = std::min(static_cast<int>(weight), flowLeft[v]);
+                    flowLeft[v] -= flow;
+                    result.edgeFlows.push_back(flow);
+                });
+                graph.forEachNeighbor(u, [&](int v, int) {
+                    pairCapacity[v] = 0;
+                    flowLeft[v] = 0;
+                });
             }
+            return;
         }
-        
-        return false;
-    }
-};
 
-class FordFulkersonMatrix {
-public:
-    static FlowResult findMaxFlow(const AdjacencyMatrix& graph, int source, int sink, SearchMethod method = SearchMethod::BFS) {
-        int V = graph.getVertexCount();
-        FlowResult result;
-        result.maxFlow = 0;
         result.flowGraph = DefinitelyNotAVector<DefinitelyNotAVector<int>>(V);
+        for (int u = 0; u < V; u++) {
+            result.flowGraph[u] = DefinitelyNotAVector<int>(V, 0);
+            graph.forEachNeighbor(u, [&](int v, int weight) {
+                result.flowGraph[u][v] += weight;
+            });
+            for (int v = 0; v < V; v++) {
+                result.flowGraph[u][v] -= residualGraph[u][v];
+            }
+        }
+        // The residual graph is scratch memory, so the dense result gets its own copy
         result.residualGraph = DefinitelyNotAVector<DefinitelyNotAVector<int>>(V);
-        
-        // Initialize graphs with zero vectors
-        for (int i = 0; i < V; i++) {
-            result.flowGraph[i] = DefinitelyNotAVector<int>(V, 0);
-            result.residualGraph[i] = DefinitelyNotAVector<int>(V, 0);
+        for (int u = 0; u < V; u++) {
+            result.residualGraph[u] = DefinitelyNotAVector<int>(V);
+            std::copy(residualGraph[u].begin(), residualGraph[u].end(), result.residualGraph[u].begin());
         }
+    }
 
-        // Initialize residual graph
+    // Largest power of two not exceeding the largest capacity
+    static int initialDelta(const ResidualGraph& rGraph, int V) {
+        int maxCapacity = 0;
         for (int u = 0; u < V; u++) {
             for (int v = 0; v < V; v++) {
-                int weight = graph.getWeight(u, v);
-                if (weight != graph.getNoEdgeValue()) {
-                    result.residualGraph[u][v] = weight;
-                }
+                maxCapacity = std::max(maxCapacity, rGraph[u][v]);
             }
         }
 
-        DefinitelyNotAVector<int> parent(V);
-        bool pathFound = false;
-        
-        while (true) {
-            // Choose search method based on parameter
-            if (method == SearchMethod::BFS) {
-                pathFound = bfs(result.residualGraph, source, sink, parent, V);
-            } else {
-                DefinitelyNotAVector<bool> visited(V, false);
-                pathFound = dfs(result.residualGraph, source, sink, parent, visited, V);
-            }
-            
-            if (!pathFound) break;
-            
-            int pathFlow = INT_MAX;
-            for (int v = sink; v != source; v = parent[v]) {
-                int u = parent[v];
-                pathFlow = std::min(pathFlow, result.residualGraph[u][v]);
-            }
-
-            for (int v = sink; v != source; v = parent[v]) {
-                int u = parent[v];
-                result.flowGraph[u][v] += pathFlow;
-                result.flowGraph[v][u] -= pathFlow;
-                result.residualGraph[u][v] -= pathFlow;
-                result.residualGraph[v][u] += pathFlow;
-            }
-
-            result.maxFlow += pathFlow;
+        int delta = 1;
+        while (delta <= maxCapacity / 2) {
+            delta *= 2;
         }
-
-        return result;
+        return delta;
     }
 
-private:
-    static bool bfs(const DefinitelyNotAVector<DefinitelyNotAVector<int>>& rGraph, 
-                   int s, int t, DefinitelyNotAVector<int>& parent, int V) {
-        DefinitelyNotAVector<bool> visited(V, false);
-        DefinitelyNotAQueue<int> queue;
-        queue.push(s);
+    // Every vertex is enqueued at most once, so a V-sized array serves as the queue
+    static bool bfs(const ResidualGraph& rGraph, int s, int t, ScratchVector<int>& parent,
+                    ScratchVector<bool>& visited, ScratchVector<int>& queue, int V, int minCapacity = 1) {
+        std::fill(visited.begin(), visited.end(), false);
+        int head = 0;
+        int tail = 0;
+        queue[tail++] = s;
         visited[s] = true;
         parent[s] = -1;
 
-        while (!queue.empty()) {
-            int u = queue.front();
-            queue.pop();
+        while (head < tail) {
+            int u = queue[head++];
 
             for (int v = 0; v < V; v++) {
-                if (!visited[v] && rGraph[u][v] > 0) {
-                    queue.push(v);
+                if (!visited[v] && rGraph[u][v] >= minCapacity) {
+                    queue[tail++] = v;
                     parent[v] = u;
                     visited[v] = true;
                 }
@@ -192,10 +187,25 @@ private:
 
         return visited[t];
     }
+
+    static bool directionOptimizingBfs(const ResidualGraph& rGraph, int s, int t, ScratchVector<int>& parent, int V,
+                                       int threads) {
+        return DirectionOptimizingBFS::run(V, s, t, parent,
+            [&rGraph, V](int u, auto&& visit) {
+                const auto& row = rGraph[u];
+                for (int v = 0; v < V; v++) {
+                    if (row[v] > 0) visit(v);
+                }
+            },
+            [&rGraph, V](int v, auto&& visit) {
+                for (int u = 0; u < V; u++) {
+                    if (rGraph[u][v] > 0 && visit(u)) return;
+                }
+            }, threads);
+    }
     
-    static bool dfs(const DefinitelyNotAVector<DefinitelyNotAVector<int>>& rGraph,
-                    int u, int t, DefinitelyNotAVector<int>& parent, 
-                    DefinitelyNotAVector<bool>& visited, int V) {
+    static bool dfs(const ResidualGraph& rGraph, int u, int t, ScratchVector<int>& parent,
+                    ScratchVector<bool>& visited, int V) {
         if (u == t) {
             return true;
         }
@@ -214,4 +224,7 @@ private:
         return false;
     }
 };
+
+using FordFulkersonList = FordFulkerson<DirectedAdjacencyList>;
+using FordFulkersonMatrix = FordFulkerson<DirectedAdjacencyMatrix>;
 #endif //FORDFULKERSON_H
\ No newline at end of file
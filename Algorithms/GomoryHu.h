@@ -0,0 +1,83 @@
+#ifndef GOMORYHU_H
+#define GOMORYHU_H
+
+#include <stdexcept>
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "../Utils/Results/GomoryHuTree.h"
+#include "../Utils/Parallel/ParallelFor.h"
+#include "../Utils/Enums/SearchMethod.h"
+#include "FordFulkerson.h"
+
+/**
+ * Gusfield's construction of a Gomory-Hu (equivalent flow) tree with V - 1 max-flow computations.
+ * Iteration s cuts s from its current tree parent and may re-hang later vertices, so the cuts of one
+ * batch are computed in parallel from the parents known at batch start and a cut is recomputed only
+ * when an earlier member of the same batch changed that vertex's parent.
+ */
+class GomoryHuBuilder {
+public:
+    // minCut(s, t) must return a FlowResult with maxFlow and sourceSide filled
+    template<typename MinCutFunction>
+    static GomoryHuTree build(int V, MinCutFunction&& minCut, int threads) {
+        GomoryHuTree tree;
+        tree.parent = DefinitelyNotAVector<int>(V, 0);
+        tree.weight = DefinitelyNotAVector<int>(V, 0);
+        if (V > 0) tree.parent[0] = -1;
+
+        if (threads < 1) threads = 1;
+        DefinitelyNotAVector<int> batchParent(threads);
+        DefinitelyNotAVector<FlowResult> batchCut(threads);
+
+        for (int first = 1; first < V; first += threads) {
+            const int count = std::min(threads, V - first);
+
+            for (int i = 0; i < count; i++) {
+                batchParent[i] = tree.parent[first + i];
+            }
+
+            ParallelFor::run(count, threads, 1, [&](int, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++) {
+                    batchCut[i] = minCut(first + static_cast<int>(i), batchParent[i]);
+                }
+            });
+
+            for (int i = 0; i < count; i++) {
+                const int s = first + i;
+                const int t = tree.parent[s];
+                if (t != batchParent[i]) {
+                    batchCut[i] = minCut(s, t);
+                }
+
+                tree.weight[s] = batchCut[i].maxFlow;
+                for (int v = s + 1; v < V; v++) {
+                    if (tree.parent[v] == t && batchCut[i].isOnSourceSide(v)) {
+                        tree.parent[v] = s;
+                    }
+                }
+            }
+        }
+
+        tree.buildQueryIndex();
+        return tree;
+    }
+};
+
+template<GraphView Graph>
+class GomoryHu {
+    static_assert(!Graph::getIsDirected(), "Gomory-Hu tree requires an undirected graph");
+
+public:
+    static GomoryHuTree buildTree(const Graph& graph,
+                                  SearchMethod method = SearchMethod::DIRECTION_OPTIMIZING_BFS,
+                                  int threads = ParallelFor::defaultThreadCount()) {
+        // The batch already keeps every thread busy, so each cut runs its searches on one thread
+        return GomoryHuBuilder::build(graph.getVertexCount(), [&graph, method](int s, int t) {
+            return FordFulkerson<Graph>::findMaxFlow(graph, s, t, method, FlowOutputMode::CUT_ONLY, nullptr, 1);
+        }, threads);
+    }
+};
+
+using GomoryHuList = GomoryHu<UndirectedAdjacencyList>;
+using GomoryHuMatrix = GomoryHu<UndirectedAdjacencyMatrix>;
+
+#endif //GOMORYHU_H
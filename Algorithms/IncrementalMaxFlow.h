@@ -0,0 +1,228 @@
+#ifndef INCREMENTALMAXFLOW_H
+#define INCREMENTALMAXFLOW_H
+
+#include <climits>
+#include <stdexcept>
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAQueue.h"
+#include "../Utils/Results/FlowResult.h"
+#include "../Utils/Representations/GraphView.h"
+#include "MinCut.h"
+
+/**
+ * Stateful max-flow solver that keeps its residual graph between calls.
+ * Capacity changes are applied to the current flow - a decrease below the flow on an arc is repaired by
+ * rerouting the surplus through the residual graph and canceling what cannot be rerouted along flow paths,
+ * after which solve() only augments from the repaired state instead of starting from zero flow.
+ * Capacity accumulates the flow value, like in FordFulkerson; single arcs keep int capacities.
+ */
+template<typename Capacity = int>
+class BasicIncrementalMaxFlow {
+private:
+    int V;
+    int source;
+    int sink;
+    Capacity maxFlow;
+    // Input arcs in forEachNeighbor() order, then arcs first created by setCapacity()
+    DefinitelyNotAVector<Edge> arcs;
+    // Combined capacity of the parallel arcs of every pair
+    DefinitelyNotAVector<DefinitelyNotAVector<int>> capacity;
+    // residual[u][v] = capacity[u][v] - flow[u][v], with flow[v][u] = -flow[u][v]
+    DefinitelyNotAVector<DefinitelyNotAVector<int>> residual;
+    DefinitelyNotAVector<int> parent;
+
+public:
+    template<GraphView Graph>
+    BasicIncrementalMaxFlow(const Graph& graph, int source, int sink)
+        : BasicIncrementalMaxFlow(graph.getVertexCount(), source, sink) {
+        arcs.reserve(graph.getEdgeCount());
+        for (int u = 0; u < V; u++) {
+            graph.forEachNeighbor(u, [&](int v, int weight) {
+                // Parallel arcs add up to one residual arc of their combined capacity
+                arcs.push_back(Edge(u, v, weight));
+                capacity[u][v] += weight;
+                residual[u][v] += weight;
+            });
+        }
+    }
+
+    // Augments along shortest residual paths from the current flow, returns the max flow value
+    Capacity solve() {
+        while (findPath(source, sink, false)) {
+            maxFlow += augment(source, sink, INT_MAX);
+        }
+        return maxFlow;
+    }
+
+    // Sets the combined capacity of from -> to: the first of its parallel arcs takes all of it, the others keep
+    // their place in the sparse output with capacity 0
+    void setCapacity(int from, int to, int newCapacity) {
+        if (from < 0 || from >= V || to < 0 || to >= V || newCapacity < 0) {
+            throw std::invalid_argument("Invalid arc or capacity");
+        }
+        if (from == to) return;
+
+        bool first = true;
+        for (auto& arc : arcs) {
+            if (arc.source != from || arc.destination != to) continue;
+            arc.weight = first ? newCapacity : 0;
+            first = false;
+        }
+        if (first) {
+            arcs.push_back(Edge(from, to, newCapacity));
+        }
+
+        residual[from][to] += newCapacity - capacity[from][to];
+        capacity[from][to] = newCapacity;
+        if (residual[from][to] >= 0) return;
+
+        // Flow on the arc exceeds the new capacity - drop the surplus from the arc first
+        int surplus = -residual[from][to];
+        residual[from][to] += surplus;
+        residual[to][from] -= surplus;
+
+        // from now has surplus inflow and to lacks inflow - reroute through the residual graph if possible
+        while (surplus > 0 && findPath(from, to, false)) {
+            surplus -= augment(from, to, surplus);
+        }
+
+        if (surplus > 0) {
+            // Whatever could not be rerouted is canceled along flow paths source -> from and to -> sink
+            if (from != source) cancelFlow(source, from, surplus);
+            if (to != sink) cancelFlow(to, sink, surplus);
+            maxFlow -= surplus;
+        }
+    }
+
+    [[nodiscard]] int getCapacity(int from, int to) const { return capacity[from][to]; }
+    [[nodiscard]] int getFlow(int from, int to) const { return capacity[from][to] - residual[from][to]; }
+    [[nodiscard]] Capacity getMaxFlow() const { return maxFlow; }
+
+    /**
+     * Snapshot of the current state in the same form the Ford-Fulkerson engines return for the input graph.
+     * Sparse flows follow the input arcs, with arcs first created by setCapacity() at the end; the flow of a pair
+     * is handed out to its parallel arcs in that order, each taking at most its own capacity.
+     */
+    [[nodiscard]] BasicFlowResult<Capacity> getResult(FlowOutputMode output = FlowOutputMode::DENSE) const {
+        BasicFlowResult<Capacity> result;
+        result.maxFlow = maxFlow;
+        result.output = output;
+        if (output == FlowOutputMode::VALUE_ONLY) return result;
+
+        result.sourceSide = MinCut::findSourceSide(residual, source, V);
+        if (output == FlowOutputMode::CUT_ONLY) return result;
+
+        if (output == FlowOutputMode::SPARSE) {
+            DefinitelyNotAVector<DefinitelyNotAVector<int>> flowLeft(V);
+            for (int u = 0; u < V; u++) {
+                flowLeft[u] = DefinitelyNotAVector<int>(V);
+                for (int v = 0; v < V; v++) {
+                    flowLeft[u][v] = std::max(0, capacity[u][v] - residual[u][v]);
+                }
+            }
+            result.edgeFlows.reserve(arcs.size());
+            for (const auto& arc : arcs) {
+                int& left = flowLeft[arc.source][arc.destination];
+                const int flow = std::min(arc.weight, left);
+                left -= flow;
+                result.edgeFlows.push_back(flow);
+            }
+        } else {
+            result.residualGraph = residual;
+            result.flowGraph = DefinitelyNotAVector<DefinitelyNotAVector<int>>(V);
+            for (int u = 0; u < V; u++) {
+                result.flowGraph[u] = DefinitelyNotAVector<int>(V, 0);
+                for (int v = 0; v < V; v++) {
+                    result.flowGraph[u][v] = capacity[u][v] - residual[u][v];
+                }
+            }
+        }
+
+        for (const auto& arc : arcs) {
+            if (result.sourceSide.test(arc.source) && !result.sourceSide.test(arc.destination)) {
+                result.cutEdges.push_back(arc);
+            }
+        }
+        return result;
+    }
+
+private:
+    BasicIncrementalMaxFlow(int vertices, int source, int sink)
+        : V(vertices), source(source), sink(sink), maxFlow(0), parent(vertices, -1) {
+        if (source < 0 || source >= V || sink < 0 || sink >= V || source == sink) {
+            throw std::invalid_argument("Invalid start/end vertices for max flow");
+        }
+
+        capacity = DefinitelyNotAVector<DefinitelyNotAVector<int>>(V);
+        residual = DefinitelyNotAVector<DefinitelyNotAVector<int>>(V);
+        for (int i = 0; i < V; i++) {
+            capacity[i] = DefinitelyNotAVector<int>(V, 0);
+            residual[i] = DefinitelyNotAVector<int>(V, 0);
+        }
+    }
+
+    // BFS from s to t over residual arcs, or over arcs carrying positive flow when alongFlow is set
+    bool findPath(int s, int t, bool alongFlow) {
+        DefinitelyNotAVector<bool> visited(V, false);
+        DefinitelyNotAQueue<int> queue;
+        queue.push(s);
+        visited[s] = true;
+        parent[s] = -1;
+
+        while (!queue.empty()) {
+            int u = queue.front();
+            queue.pop();
+
+            for (int v = 0; v < V; v++) {
+                const int available = alongFlow ? capacity[u][v] - residual[u][v] : residual[u][v];
+                if (!visited[v] && available > 0) {
+                    parent[v] = u;
+                    if (v == t) return true;
+                    visited[v] = true;
+                    queue.push(v);
+                }
+            }
+        }
+
+        return false;
+    }
+
+    // Pushes up to limit units along the path stored in parent, returns the amount pushed
+    int augment(int s, int t, int limit) {
+        int pathFlow = limit;
+        for (int v = t; v != s; v = parent[v]) {
+            pathFlow = std::min(pathFlow, residual[parent[v]][v]);
+        }
+
+        for (int v = t; v != s; v = parent[v]) {
+            residual[parent[v]][v] -= pathFlow;
+            residual[v][parent[v]] += pathFlow;
+        }
+        return pathFlow;
+    }
+
+    // Removes amount units of flow from paths s -> t that carry flow
+    void cancelFlow(int s, int t, int amount) {
+        while (amount > 0) {
+            if (!findPath(s, t, true)) {
+                throw std::logic_error("Flow decomposition failed while repairing a capacity decrease");
+            }
+
+            int pathFlow = amount;
+            for (int v = t; v != s; v = parent[v]) {
+                const int u = parent[v];
+                pathFlow = std::min(pathFlow, capacity[u][v] - residual[u][v]);
+            }
+
+            for (int v = t; v != s; v = parent[v]) {
+                residual[parent[v]][v] += pathFlow;
+                residual[v][parent[v]] -= pathFlow;
+            }
+            amount -= pathFlow;
+        }
+    }
+};
+
+using IncrementalMaxFlow = BasicIncrementalMaxFlow<int>;
+
+#endif //INCREMENTALMAXFLOW_H
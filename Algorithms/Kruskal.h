@@ -1,39 +1,93 @@
 #ifndef KRUSKAL_H
 #define KRUSKAL_H
 
+#include <algorithm>
+#include <numeric>
 #include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
 #include "../Utils/DefinitelyNotADataStructures/UnionFind.h"
 #include "../Utils/Results/MSTResult.h"
+#include "../Utils/GraphData.h"
 #include "../Utils/Representations/Edge.h"
-#include "Sorting.h"
+#include "../Utils/Representations/GraphView.h"
+#include "../Utils/Representations/AdjacencyList.h"
+#include "../Utils/Representations/AdjancencyMatrix.h"
 
-template<typename GraphRepresentation>
+template<GraphView Graph, typename Total = int>
 class KruskalAlgorithm {
+private:
+    using Weight = decltype(Graph::getNoEdgeValue());
+
 public:
-    static MSTResult findMST(const GraphRepresentation& graph) {
-        MSTResult result;
+    // Sort keys are built straight from the edge stream of the representation, into exactly sized scratch memory.
+    // Equal weights are ordered by endpoints, so every representation of a graph yields the same tree.
+    static BasicMSTResult<Total> findMST(const Graph& graph, AlgorithmWorkspace* workspace = nullptr) {
+        BasicMSTResult<Total> result;
 
-        // Convert graph representation to edge list
-        auto edges = graph.toEdgeList();
+        ScratchVector<WeightedEdge<Weight>> edges{WorkspaceAllocator<WeightedEdge<Weight>>(workspace)};
+        edges.reserve(graph.getEdgeCount());
+        graph.forEachEdge([&edges](int source, int destination, Weight weight) {
+            edges.emplace_back(source, destination, weight);
+        });
 
-        // Sort edges by weight
-        Sorting::QuickSort(edges, 0, edges.size() - 1);
+        std::sort(edges.begin(), edges.end(), [](const WeightedEdge<Weight>& a, const WeightedEdge<Weight>& b) {
+            if (a.weight != b.weight) return a.weight < b.weight;
+            if (a.source != b.source) return a.source < b.source;
+            return a.destination < b.destination;
+        });
 
-        // Initialize Union-Find data structure
-        UnionFind uf(graph.getVertexCount());
+        UnionFind uf(graph.getVertexCount(), workspace);
 
         // Process edges in sorted order
-        for (const Edge& edge : edges) {
+        for (const auto& edge : edges) {
             if (uf.find(edge.source) != uf.find(edge.destination)) {
                 uf.unite(edge.source, edge.destination);
-                result.edges.emplace_back(edge.source, edge.destination, edge.weight);
+                result.edges.emplace_back(edge.source, edge.destination, static_cast<int>(edge.weight));
                 result.totalWeight += edge.weight;
             }
         }
 
         return result;
     }
+
+    // Runs straight on the columnar edge store of loaded or generated data
+    template<typename DataWeight>
+    static BasicMSTResult<Total> findMST(const WeightedGraphData<DataWeight>& data, AlgorithmWorkspace* workspace = nullptr) {
+        return fromEdgeStore(data.edges, data.numVertices, workspace);
+    }
+
+private:
+    // Only an index array is sorted, no edge objects are built. Ties are broken by endpoints, then by input order.
+    template<typename EdgeWeight>
+    static BasicMSTResult<Total> fromEdgeStore(const EdgeStore<EdgeWeight>& edges, int vertices, AlgorithmWorkspace* workspace) {
+        BasicMSTResult<Total> result;
+        const auto& sources = edges.getSources();
+        const auto& destinations = edges.getDestinations();
+        const auto& weights = edges.getWeights();
+
+        ScratchVector<int> order(edges.size(), WorkspaceAllocator<int>(workspace));
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](int a, int b) {
+            if (weights[a] != weights[b]) return weights[a] < weights[b];
+            if (sources[a] != sources[b]) return sources[a] < sources[b];
+            if (destinations[a] != destinations[b]) return destinations[a] < destinations[b];
+            return a < b;
+        });
+
+        UnionFind uf(vertices, workspace);
+
+        for (const int i : order) {
+            if (uf.find(sources[i]) != uf.find(destinations[i])) {
+                uf.unite(sources[i], destinations[i]);
+                result.edges.emplace_back(sources[i], destinations[i], static_cast<int>(weights[i]));
+                result.totalWeight += weights[i];
+            }
+        }
+
+        return result;
+    }
 };
 
+using KruskalList = KruskalAlgorithm<UndirectedAdjacencyList>;
+using KruskalMatrix = KruskalAlgorithm<UndirectedAdjacencyMatrix>;
 
 #endif //KRUSKAL_H
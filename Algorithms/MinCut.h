@@ -0,0 +1,54 @@
+#ifndef MINCUT_H
+#define MINCUT_H
+
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotABitset.h"
+#include "../Utils/Results/FlowResult.h"
+#include "../Utils/Representations/GraphView.h"
+
+// Extracts the minimum cut implied by a final residual graph of any max-flow engine
+class MinCut {
+public:
+    // Single reachability pass over the residual graph (any V x V array of rows)
+    template<typename ResidualGraph>
+    static DefinitelyNotABitset findSourceSide(const ResidualGraph& rGraph, int source, int V) {
+        DefinitelyNotABitset reached(V);
+        DefinitelyNotAVector<int> stack(V);
+        int top = 0;
+
+        reached.set(source);
+        stack[top++] = source;
+
+        while (top > 0) {
+            const int u = stack[--top];
+            const auto& row = rGraph[u];
+            for (int v = 0; v < V; v++) {
+                if (row[v] > 0 && !reached.test(v)) {
+                    reached.set(v);
+                    stack[top++] = v;
+                }
+            }
+        }
+
+        return reached;
+    }
+
+    // Source side plus every input arc crossing from it to the sink side
+    template<GraphView Graph, typename Capacity, typename ResidualGraph>
+    static void extract(BasicFlowResult<Capacity>& result, const Graph& graph, const ResidualGraph& rGraph, int source) {
+        const int V = graph.getVertexCount();
+        result.sourceSide = findSourceSide(rGraph, source, V);
+        result.cutEdges = DefinitelyNotAVector<Edge>();
+
+        for (int u = 0; u < V; u++) {
+            if (!result.sourceSide.test(u)) continue;
+            graph.forEachNeighbor(u, [&](int v, int weight) {
+                if (!result.sourceSide.test(v)) {
+                    result.cutEdges.push_back(Edge(u, v, weight));
+                }
+            });
+        }
+    }
+};
+
+#endif //MINCUT_H
@@ -0,0 +1,172 @@
+#ifndef MULTISOURCEBFS_H
+#define MULTISOURCEBFS_H
+
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <algorithm>
+#include <utility>
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotABitset.h"
+#include "../Utils/Results/MultiSourceBFSResult.h"
+#include "../Utils/Representations/GraphView.h"
+#include "../Utils/Representations/AdjacencyList.h"
+#include "../Utils/Representations/AdjancencyMatrix.h"
+
+// Number of 64-bit words per vertex mask - 4 words (256 concurrent traversals) when AVX2 can process them at once
+#if defined(__AVX2__)
+constexpr int MSBFS_DEFAULT_WORDS = 4;
+#else
+constexpr int MSBFS_DEFAULT_WORDS = 1;
+#endif
+
+// One bit per concurrent traversal
+template<int Words>
+struct LaneMask {
+    uint64_t w[Words] = {};
+
+    [[nodiscard]] bool any() const {
+        uint64_t acc = 0;
+        for (int k = 0; k < Words; k++) acc |= w[k];
+        return acc != 0;
+    }
+
+    void set(int lane) {
+        w[lane >> 6] |= uint64_t(1) << (lane & 63);
+    }
+
+    // Lanes present in this mask but not in other
+    [[nodiscard]] LaneMask without(const LaneMask& other) const {
+        LaneMask result;
+        for (int k = 0; k < Words; k++) result.w[k] = w[k] & ~other.w[k];
+        return result;
+    }
+
+    LaneMask& operator|=(const LaneMask& other) {
+        for (int k = 0; k < Words; k++) w[k] |= other.w[k];
+        return *this;
+    }
+
+    void clear() {
+        for (int k = 0; k < Words; k++) w[k] = 0;
+    }
+
+    // Calls f(lane) for every set lane
+    template<typename F>
+    void forEachLane(F&& f) const {
+        for (int k = 0; k < Words; k++) {
+            uint64_t bits = w[k];
+            while (bits != 0) {
+                f(k * 64 + std::countr_zero(bits));
+                bits &= bits - 1;
+            }
+        }
+    }
+};
+
+// Shared MS-BFS core: one sweep over the frontier advances every traversal of the batch
+template<int Words>
+class MultiSourceBFSEngine {
+public:
+    static constexpr int LANES = 64 * Words;
+
+    template<typename ForEachNeighbor>
+    static MultiSourceBFSResult run(int V, const DefinitelyNotAVector<int>& sources, bool withHops,
+                                    ForEachNeighbor forEachNeighbor) {
+        MultiSourceBFSResult result;
+        result.sources = sources;
+        result.reachable = DefinitelyNotAVector<DefinitelyNotABitset>(sources.size());
+        for (size_t i = 0; i < sources.size(); i++) {
+            if (sources[i] < 0 || sources[i] >= V) {
+                throw std::invalid_argument("Invalid source vertex for multi-source BFS");
+            }
+            result.reachable[i] = DefinitelyNotABitset(V);
+        }
+
+        if (withHops) {
+            result.hops = DefinitelyNotAVector<DefinitelyNotAVector<int>>(sources.size());
+            for (size_t i = 0; i < sources.size(); i++) {
+                result.hops[i] = DefinitelyNotAVector<int>(V, -1);
+            }
+        }
+
+        for (size_t first = 0; first < sources.size(); first += LANES) {
+            const int count = static_cast<int>(std::min<size_t>(LANES, sources.size() - first));
+            runBatch(V, static_cast<int>(first), count, withHops, result, forEachNeighbor);
+        }
+
+        return result;
+    }
+
+private:
+    template<typename ForEachNeighbor>
+    static void runBatch(int V, int first, int count, bool withHops, MultiSourceBFSResult& result,
+                         ForEachNeighbor& forEachNeighbor) {
+        DefinitelyNotAVector<LaneMask<Words>> seen(V);
+        DefinitelyNotAVector<LaneMask<Words>> visit(V);
+        DefinitelyNotAVector<LaneMask<Words>> visitNext(V);
+
+        for (int lane = 0; lane < count; lane++) {
+            int s = result.sources[first + lane];
+            seen[s].set(lane);
+            visit[s].set(lane);
+            if (withHops) {
+                result.hops[first + lane][s] = 0;
+            }
+        }
+
+        int level = 0;
+        bool active = true;
+        while (active) {
+            active = false;
+            level++;
+
+            for (int v = 0; v < V; v++) {
+                if (!visit[v].any()) continue;
+
+                forEachNeighbor(v, [&](int n) {
+                    const LaneMask<Words> discovered = visit[v].without(seen[n]);
+                    if (!discovered.any()) return;
+
+                    visitNext[n] |= discovered;
+                    seen[n] |= discovered;
+                    active = true;
+
+                    if (withHops) {
+                        discovered.forEachLane([&](int lane) {
+                            result.hops[first + lane][n] = level;
+                        });
+                    }
+                });
+                visit[v].clear();
+            }
+
+            std::swap(visit, visitNext);
+        }
+
+        for (int v = 0; v < V; v++) {
+            seen[v].forEachLane([&](int lane) {
+                result.reachable[first + lane].set(v);
+            });
+        }
+    }
+};
+
+template<GraphView Graph>
+class MultiSourceBFS {
+public:
+    template<int Words = MSBFS_DEFAULT_WORDS>
+    static MultiSourceBFSResult run(const Graph& graph, const DefinitelyNotAVector<int>& sources, bool withHops = true) {
+        return MultiSourceBFSEngine<Words>::run(graph.getVertexCount(), sources, withHops,
+            [&graph](int u, auto&& visitNeighbor) {
+                graph.forEachNeighbor(u, [&](int v, int) {
+                    visitNeighbor(v);
+                });
+            });
+    }
+};
+
+using MultiSourceBFSList = MultiSourceBFS<DirectedAdjacencyList>;
+using MultiSourceBFSMatrix = MultiSourceBFS<DirectedAdjacencyMatrix>;
+
+#endif //MULTISOURCEBFS_H
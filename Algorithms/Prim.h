@@ -4,19 +4,23 @@
 #include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
 #include "../Utils/Results/MSTResult.h"
 #include "../Utils/BinaryHeap.h"
+#include "../Utils/Representations/GraphView.h"
+#include "../Utils/Representations/AdjacencyList.h"
+#include "../Utils/Representations/AdjancencyMatrix.h"
 
-class PrimList {
+template<GraphView Graph, typename Total = int>
+class Prim {
 public:
-    static MSTResult findMST(const AdjacencyList& graph) {
+    static BasicMSTResult<Total> findMST(const Graph& graph, AlgorithmWorkspace* workspace = nullptr) {
         int V = graph.getVertexCount();
-        MSTResult result;
+        BasicMSTResult<Total> result;
         result.totalWeight = 0;
 
-        DefinitelyNotAVector<bool> included(V, false);
-        DefinitelyNotAVector<int> key(V, INT_MAX);
-        DefinitelyNotAVector<int> parent(V, -1);
+        ScratchVector<bool> included(V, false, WorkspaceAllocator<bool>(workspace));
+        ScratchVector<int> key(V, INT_MAX, WorkspaceAllocator<int>(workspace));
+        ScratchVector<int> parent(V, -1, WorkspaceAllocator<int>(workspace));
         
-        BinaryHeap<int> minHeap(V);
+        BinaryHeap<int> minHeap(V, workspace);
         key[0] = 0;
         minHeap.insert(0, 0, 0);
 
@@ -24,10 +28,7 @@ public:
             int u = minHeap.extractMin().vertex;
             included[u] = true;
 
-            for (const auto& edge : graph.getAdjacent(u)) {
-                int v = edge.destination;
-                int weight = edge.weight;
-
+            graph.forEachNeighbor(u, [&](int v, int weight) {
                 if (!included[v] && weight < key[v]) {
                     key[v] = weight;
                     parent[v] = u;
@@ -38,55 +39,7 @@ public:
                         minHeap.insert(weight, v, v);
                     }
                 }
-            }
-        }
-
-        // Construct result
-        for (int i = 1; i < V; i++) {
-            if (parent[i] != -1) {
-                result.edges.push_back(DefinitelyNotATuple(parent[i], i, key[i]));
-                result.totalWeight += key[i];
-            }
-        }
-
-        return result;
-    }
-};
-
-class PrimMatrix {
-public:
-    static MSTResult findMST(const AdjacencyMatrix& graph) {
-        int V = graph.getVertexCount();
-        MSTResult result;
-        result.totalWeight = 0;
-
-        DefinitelyNotAVector<bool> included(V, false);
-        DefinitelyNotAVector<int> key(V, INT_MAX);
-        DefinitelyNotAVector<int> parent(V, -1);
-        
-        BinaryHeap<int> minHeap(V);
-        key[0] = 0;
-        minHeap.insert(0, 0, 0);
-
-        while (!minHeap.empty()) {
-            int u = minHeap.extractMin().vertex;
-            included[u] = true;
-
-            for (int v = 0; v < V; v++) {
-                int weight = graph.getWeight(u, v);
-                
-                if (weight != graph.getNoEdgeValue() && 
-                    !included[v] && weight < key[v]) {
-                    key[v] = weight;
-                    parent[v] = u;
-                    
-                    if (minHeap.contains(v)) {
-                        minHeap.decreaseKey(v, weight);
-                    } else {
-                        minHeap.insert(weight, v, v);
-                    }
-                }
-            }
+            });
         }
 
         // Construct result
@@ -100,4 +53,7 @@ public:
         return result;
     }
 };
-#endif //PRIM_H
\ No newline at end of file
+
+using PrimList = Prim<UndirectedAdjacencyList>;
+using PrimMatrix = Prim<UndirectedAdjacencyMatrix>;
+#endif //PRIM_H
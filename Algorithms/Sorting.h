@@ -7,7 +7,8 @@
 class Sorting
 {
 public:
-     static void QuickSort(DefinitelyNotAVector<Edge>& edges,
+     template<typename Weight>
+     static void QuickSort(DefinitelyNotAVector<WeightedEdge<Weight>>& edges,
                          int low, int high) {
         if (low < high) {
             int pi = partition(edges, low, high);
@@ -16,7 +17,8 @@ public:
         }
     }
 
-    static int partition(DefinitelyNotAVector<Edge>& edges,
+    template<typename Weight>
+    static int partition(DefinitelyNotAVector<WeightedEdge<Weight>>& edges,
                         int low, int high)
     {
         auto pivot = edges[high].weight;
@@ -34,10 +36,11 @@ public:
         return i + 1;
     }
 
-    static void MySwap(Edge& a,
-                    Edge& b)
+    template<typename Weight>
+    static void MySwap(WeightedEdge<Weight>& a,
+                    WeightedEdge<Weight>& b)
     {
-        const Edge temp = a;
+        const WeightedEdge<Weight> temp = a;
         a = b;
         b = temp;
     }
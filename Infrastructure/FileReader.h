@@ -2,72 +2,199 @@
 #define FILEREADER_H
 
 #include <string>
-#include <fstream>
+#include <algorithm>
 #include <iostream>
 #include "../Utils/Enums/GraphProblemType.h"
 #include "../Utils/GraphData.h"
 #include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "IntegerScanner.h"
+#include "MappedFile.h"
+#include "GraphSnapshot.h"
+#include "GraphImporter.h"
+#include "../Utils/Parallel/ParallelFor.h"
 
 class FileReader {
 public:
     static GraphData readGraphFromFile(const GraphProblemType& problemType) {
         std::string fileName;
-        std::cout << "Enter the file name (full file path): ";
+        std::cout << "Enter the file name (full file path; text, DIMACS, METIS, Matrix Market, SNAP or snapshot): ";
         std::cin >> fileName;
 
-        std::ifstream file(fileName);
-        if (!file.is_open()) {
-            throw std::runtime_error("Could not open file: " + fileName);
+        return readGraphFromFile(fileName, problemType);
+    }
+
+    // Non-interactive - maps the file and parses it in place, without stream extraction
+    static GraphData readGraphFromFile(const std::string& fileName, const GraphProblemType& problemType) {
+        const MappedFile file(fileName);
+
+        // Binary snapshots and benchmark formats carry their own headers
+        const GraphFileFormat format = GraphImporter::detectFormat(fileName, file.data(), file.size());
+        if (format == GraphFileFormat::SNAPSHOT) {
+            GraphData graphData = GraphSnapshot::toGraphData(file.data(), file.size(), fileName);
+            adaptToProblem(graphData, problemType);
+            validateGraphData(graphData, problemType);
+            return graphData;
         }
+        if (format != GraphFileFormat::NATIVE) {
+            GraphData graphData = GraphImporter::parse(file.data(), file.size(), format);
+            adaptToProblem(graphData, problemType);
+            validateGraphData(graphData, problemType);
+            return graphData;
+        }
+
+        IntegerScanner scanner(file.data(), file.data() + file.size());
 
         GraphData graphData;
 
         // Read first line based on problem type
+        bool headerRead = false;
         switch (problemType) {
             case GraphProblemType::MST:
-                file >> graphData.numEdges >> graphData.numVertices;
+                headerRead = scanner.next(graphData.numEdges) && scanner.next(graphData.numVertices);
                 graphData.startVertex = -1;
                 graphData.endVertex = -1;
                 break;
 
             case GraphProblemType::SHORTEST_PATH:
-                file >> graphData.numEdges >> graphData.numVertices >> graphData.startVertex;
+                headerRead = scanner.next(graphData.numEdges) && scanner.next(graphData.numVertices)
+                             && scanner.next(graphData.startVertex);
                 graphData.endVertex = -1;
                 break;
 
             case GraphProblemType::MAX_FLOW:
-                file >> graphData.numEdges >> graphData.numVertices
-                     >> graphData.startVertex >> graphData.endVertex;
+                headerRead = scanner.next(graphData.numEdges) && scanner.next(graphData.numVertices)
+                             && scanner.next(graphData.startVertex) && scanner.next(graphData.endVertex);
                 break;
         }
+        if (!headerRead) {
+            throw std::runtime_error("Incomplete header in file: " + fileName);
+        }
 
-        // Read edges
-        for (int i = 0; i < graphData.numEdges; i++) {
-            int start, end, weight;
-            file >> start >> end >> weight;
-
-            graphData.edges.emplace_back(start, end, weight);
-
-            // For MST, add reverse edge as it's undirected
-            if (problemType == GraphProblemType::MST) {
-                graphData.edges.emplace_back(end, start, weight);
-            }
+        // MST graphs are undirected - every edge is stored once and the converter mirrors it where needed
+        graphData.isUndirected = problemType == GraphProblemType::MST;
+        if (graphData.numEdges > 0) {
+            parseEdges(file.data(), scanner.current(), file.data() + file.size(), graphData);
         }
 
-        file.close();
         validateGraphData(graphData, problemType);
         return graphData;
     }
 
 private:
+    // Each parsing thread gets at least this much of the file
+    static constexpr size_t MIN_CHUNK_BYTES = size_t(1) << 20;
+
+    /**
+     * Splits the edge section into newline-aligned chunks and parses them in parallel into per-thread number buffers.
+     * A prefix sum over the buffer sizes gives every number its global position, so the edges land in the same
+     * slots for any thread count, even when an edge is spread over more than one line.
+     * Only the first 3 * numEdges numbers are edges - whatever follows them is ignored, malformed or not.
+     */
+    static void parseEdges(const char* origin, const char* begin, const char* end, GraphData& graphData,
+                           int threads = ParallelFor::defaultThreadCount()) {
+        const size_t bytes = static_cast<size_t>(end - begin);
+        threads = static_cast<int>(std::max<size_t>(1, std::min<size_t>(threads, bytes / MIN_CHUNK_BYTES)));
+
+        DefinitelyNotAVector<const char*> boundaries(threads + 1);
+        boundaries[0] = begin;
+        boundaries[threads] = end;
+        for (int t = 1; t < threads; t++) {
+            const char* cut = std::max(begin + bytes * t / threads, boundaries[t - 1]);
+            while (cut < end && *cut != '\n') ++cut;
+            boundaries[t] = cut < end ? cut + 1 : end;
+        }
+
+        const size_t edgeCount = static_cast<size_t>(graphData.numEdges);
+        const size_t needed = 3 * edgeCount;
+
+        // No chunk can hold more edge numbers than the whole file needs, so each stops there or at a malformed one
+        DefinitelyNotAVector<DefinitelyNotAVector<int>> numbers(threads);
+        DefinitelyNotAVector<std::string> errors(threads);
+        ParallelFor::run(threads, threads, 1, [&](int, size_t first, size_t last) {
+            for (size_t t = first; t < last; t++) {
+                try {
+                    IntegerScanner scanner(boundaries[t], boundaries[t + 1], origin);
+                    auto& buffer = numbers[t];
+                    buffer.reserve(std::min(needed, static_cast<size_t>(boundaries[t + 1] - boundaries[t]) / 4));
+                    int value;
+                    while (buffer.size() < needed && scanner.next(value)) {
+                        buffer.push_back(value);
+                    }
+                } catch (const std::exception& e) {
+                    errors[t] = e.what();
+                }
+            }
+        });
+
+        // A malformed number only counts when the edges before it are not enough - the first such chunk reports it
+        DefinitelyNotAVector<size_t> offsets(threads + 1, 0);
+        for (int t = 0; t < threads; t++) {
+            if (offsets[t] >= needed) {
+                numbers[t] = DefinitelyNotAVector<int>();
+            } else if (!errors[t].empty() && offsets[t] + numbers[t].size() < needed) {
+                throw std::runtime_error(errors[t]);
+            }
+            offsets[t + 1] = offsets[t] + numbers[t].size();
+        }
+
+        if (offsets[threads] / 3 < edgeCount) {
+            throw std::runtime_error("File ended after " + std::to_string(offsets[threads] / 3) + " of "
+                                     + std::to_string(edgeCount) + " edges");
+        }
+        graphData.edges.resize(edgeCount);
+
+        // Numbers past the end of a chunk belong to an edge that started in it - looked up in the later chunks
+        auto numberAt = [&](size_t index) {
+            const auto chunk = std::upper_bound(offsets.begin(), offsets.end(), index) - offsets.begin() - 1;
+            return numbers[chunk][index - offsets[chunk]];
+        };
+
+        ParallelFor::run(threads, threads, 1, [&](int, size_t first, size_t last) {
+            for (size_t t = first; t < last; t++) {
+                const size_t firstEdge = (offsets[t] + 2) / 3;
+                const size_t lastEdge = std::min(edgeCount, (offsets[t + 1] + 2) / 3);
+                for (size_t e = firstEdge; e < lastEdge; e++) {
+                    const size_t index = 3 * e;
+                    if (index + 2 < offsets[t + 1]) {
+                        const int* edge = numbers[t].data() + (index - offsets[t]);
+                        graphData.edges.set(e, edge[0], edge[1], edge[2]);
+                    } else {
+                        graphData.edges.set(e, numberAt(index), numberAt(index + 1), numberAt(index + 2));
+                    }
+                }
+            }
+        });
+    }
+
+    /**
+     * Imported files and snapshots say nothing about the problem they are loaded for: MST reads every arc as an undirected edge,
+     * shortest path starts at vertex 0 and max flow runs from 0 to V - 1 unless the file names a source and sink.
+     */
+    static void adaptToProblem(GraphData& data, const GraphProblemType& problemType) {
+        switch (problemType) {
+            case GraphProblemType::MST:
+                data.isUndirected = true;
+                break;
+
+            case GraphProblemType::SHORTEST_PATH:
+                if (data.startVertex == -1) data.startVertex = 0;
+                break;
+
+            case GraphProblemType::MAX_FLOW:
+                if (data.startVertex == -1) data.startVertex = 0;
+                if (data.endVertex == -1) data.endVertex = data.numVertices - 1;
+                break;
+        }
+    }
+
     static void validateGraphData(const GraphData& data, const GraphProblemType& problemType) {
         if (data.numVertices < 0 || data.numEdges < 0) {
             throw std::invalid_argument("Number of vertices and edges must be non-negative");
         }
 
-        for (const auto& edge : data.edges) {
-            if (edge.first() < 0 || edge.first() >= data.numVertices ||
-                edge.second() < 0 || edge.second() >= data.numVertices) {
+        for (size_t i = 0; i < data.edges.size(); i++) {
+            if (data.edges.source(i) < 0 || data.edges.source(i) >= data.numVertices ||
+                data.edges.destination(i) < 0 || data.edges.destination(i) >= data.numVertices) {
                 throw std::invalid_argument("Invalid vertex number detected");
             }
         }
@@ -69,7 +69,8 @@ private:
     static void writeRepresentationCsvForType1(const std::map<int, std::map<std::string, long>>& representationData,
                                       const std::vector<Algorithm>& algorithms,
                                       const std::string& filename,
-                                      GraphRepresentationType representation);
+                                      GraphRepresentationType representation,
+                                      uint64_t seed);
     
     /**
      * Writes CSV file for a specific density (Type 2)
@@ -77,7 +78,8 @@ private:
     static void writeDensityCsvForType2(const std::map<int, std::map<std::string, long>>& densityData,
                                const std::vector<Algorithm>& algorithms,
                                const std::string& filename,
-                               int density);
+                               int density,
+                               uint64_t seed);
 };
 
 // Implementation
@@ -105,7 +107,7 @@ inline void FileWriter::writeType1ChartData(const std::vector<GraphDataHandler>&
     // Create separate CSV files for each representation
     for (const auto& [representation, representationData] : organizedData) {
         std::string repFilename = filename + "_type1_" + representationToString(representation) + ".csv";
-        writeRepresentationCsvForType1(representationData, algorithms, repFilename, representation);
+        writeRepresentationCsvForType1(representationData, algorithms, repFilename, representation, data.front().Seed);
     }
 }
 
@@ -132,7 +134,7 @@ inline void FileWriter::writeType2ChartData(const std::vector<GraphDataHandler>&
     // Create separate CSV files for each density
     for (const auto& [density, densityData] : organizedData) {
         std::string densityFilename = filename + "_type2_density" + std::to_string(density) + ".csv";
-        writeDensityCsvForType2(densityData, algorithms, densityFilename, density);
+        writeDensityCsvForType2(densityData, algorithms, densityFilename, density, data.front().Seed);
     }
 }
 
@@ -172,7 +174,7 @@ std::vector<Algorithm> FileWriter::getAlgorithmsForProblemType(GraphProblemType
         case GraphProblemType::SHORTEST_PATH:
             return {Algorithm::DIJKSTRA, Algorithm::BELLMAN_FORD};
         case GraphProblemType::MAX_FLOW:
-            return {Algorithm::FORD_FULKERSON_DFS, Algorithm::FORD_FULKERSON_BFS};
+            return {Algorithm::FORD_FULKERSON_DFS, Algorithm::FORD_FULKERSON_BFS, Algorithm::FORD_FULKERSON_DOBFS, Algorithm::FORD_FULKERSON_SCALING};
         default:
             return {};
     }
@@ -187,6 +189,8 @@ inline std::string FileWriter::algorithmToString(Algorithm algorithm)
         case Algorithm::BELLMAN_FORD: return "Bellman-Ford";
         case Algorithm::FORD_FULKERSON_DFS: return "Ford-Fulkerson-DFS";
         case Algorithm::FORD_FULKERSON_BFS: return "Ford-Fulkerson-BFS";
+        case Algorithm::FORD_FULKERSON_DOBFS: return "Ford-Fulkerson-DOBFS";
+        case Algorithm::FORD_FULKERSON_SCALING: return "Ford-Fulkerson-Scaling";
         default: return "Unknown";
     }
 }
@@ -203,7 +207,8 @@ inline std::string FileWriter::representationToString(GraphRepresentationType re
 inline void FileWriter::writeRepresentationCsvForType1(const std::map<int, std::map<std::string, long>>& representationData,
                                        const std::vector<Algorithm>& algorithms,
                                        const std::string& filename,
-                                       GraphRepresentationType representation)
+                                       GraphRepresentationType representation,
+                                       uint64_t seed)
 {
     std::ofstream file(filename);
     if (!file.is_open()) {
@@ -224,8 +229,8 @@ inline void FileWriter::writeRepresentationCsvForType1(const std::map<int, std::
         }
     }
     
-    // Write header: VertexCount followed by algorithm-density combinations
-    file << "VertexCount";
+    // Write header: VertexCount and the seed of the measured graphs, followed by algorithm-density combinations
+    file << "VertexCount,Seed";
     for (const auto& algorithm : algorithms) {
         for (int density : uniqueDensities) {
             file << "," << algorithmToString(algorithm) << "_density" << density;
@@ -235,7 +240,7 @@ inline void FileWriter::writeRepresentationCsvForType1(const std::map<int, std::
     
     // Write data rows
     for (const auto& [vertexCount, algoData] : representationData) {
-        file << vertexCount;
+        file << vertexCount << "," << seed;
         
         // For each algorithm-density combination
         for (const auto& algorithm : algorithms) {
@@ -260,7 +265,8 @@ inline void FileWriter::writeRepresentationCsvForType1(const std::map<int, std::
 inline void FileWriter::writeDensityCsvForType2(const std::map<int, std::map<std::string, long>>& densityData,
                                  const std::vector<Algorithm>& algorithms,
                                  const std::string& filename,
-                                 int density)
+                                 int density,
+                                 uint64_t seed)
 {
     std::ofstream file(filename);
     if (!file.is_open()) {
@@ -268,8 +274,8 @@ inline void FileWriter::writeDensityCsvForType2(const std::map<int, std::map<std
         return;
     }
     
-    // Write header: VertexCount followed by algorithm-representation combinations
-    file << "VertexCount";
+    // Write header: VertexCount and the seed of the measured graphs, followed by algorithm-representation combinations
+    file << "VertexCount,Seed";
     std::vector<GraphRepresentationType> representations = {
         GraphRepresentationType::ADJACENCY_MATRIX,
         GraphRepresentationType::ADJACENCY_LIST
@@ -284,7 +290,7 @@ inline void FileWriter::writeDensityCsvForType2(const std::map<int, std::map<std
     
     // Write data rows
     for (const auto& [vertexCount, algoRepData] : densityData) {
-        file << vertexCount;
+        file << vertexCount << "," << seed;
         
         // For each algorithm-representation combination
         for (const auto& algorithm : algorithms) {
@@ -0,0 +1,206 @@
+#ifndef GRAPHCACHE_H
+#define GRAPHCACHE_H
+
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../Utils/GraphData.h"
+#include "../Utils/Enums/GraphFamily.h"
+#include "GraphSnapshot.h"
+#include "MappedFile.h"
+#include "RandomGraphGenerator.h"
+
+struct GraphCacheKey {
+    int vertices;
+    int density;
+    bool directed;
+    uint64_t seed;
+    GraphFamily family = GraphFamily::UNIFORM;
+
+    auto operator<=>(const GraphCacheKey&) const = default;
+};
+
+/**
+ * Generated graphs by (V, density, directed, seed, family).
+ * Graphs stay in memory until the byte budget forces out the least recently used ones; with a directory they are
+ * also stored there as snapshots, so later runs of the program load them instead of generating them again.
+ * The directory has a byte budget of its own - every load refreshes the time of a snapshot and every store removes
+ * the snapshots used longest ago until the rest fits.
+ */
+class GraphCache {
+private:
+    struct Entry {
+        std::shared_ptr<const GraphData> graph;
+        size_t bytes;
+        std::list<GraphCacheKey>::iterator recent;
+    };
+
+    std::filesystem::path directory;
+    size_t memoryBudget;
+    size_t diskBudget;
+    size_t bytesHeld = 0;
+    std::map<GraphCacheKey, Entry> entries;
+    std::list<GraphCacheKey> recency; // most recently used first
+
+    size_t memoryHits = 0;
+    size_t diskHits = 0;
+    size_t generated = 0;
+
+public:
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = size_t(1) << 30;
+    static constexpr size_t DEFAULT_DISK_BUDGET = size_t(2) << 30;
+
+    // An empty directory keeps the cache in memory only
+    explicit GraphCache(std::filesystem::path directory = {}, const size_t memoryBudget = DEFAULT_MEMORY_BUDGET,
+                        const size_t diskBudget = DEFAULT_DISK_BUDGET)
+        : directory(std::move(directory)), memoryBudget(memoryBudget), diskBudget(diskBudget) {}
+
+    std::shared_ptr<const GraphData> get(const GraphCacheKey& key) {
+        if (const auto found = entries.find(key); found != entries.end()) {
+            recency.splice(recency.begin(), recency, found->second.recent);
+            memoryHits++;
+            return found->second.graph;
+        }
+
+        std::shared_ptr<const GraphData> graph = load(key);
+        if (graph != nullptr) {
+            diskHits++;
+        } else {
+            RandomGraphGenerator generator(key.seed);
+            // In snapshot order, so this run and later runs that load the snapshot see the edges in the same order
+            graph = std::make_shared<const GraphData>(GraphSnapshot::canonicalOrder(
+                generator.generate(key.family, key.vertices, key.density, key.directed)));
+            generated++;
+            store(key, *graph);
+        }
+
+        insert(key, graph);
+        return graph;
+    }
+
+    // A graph above the memory budget would only push every other graph out, and its GraphData alone doubles the
+    // memory a benchmark needs - callers generate such graphs straight into their representation instead.
+    // Only uniform graphs can be generated that way, so graphs of the other families are always cached
+    [[nodiscard]] bool fitsInMemory(const GraphCacheKey& key) const {
+        if (key.family != GraphFamily::UNIFORM) return true;
+
+        const auto edges = static_cast<size_t>(RandomGraphGenerator::edgeCount(key.vertices, key.density, key.directed));
+        return sizeOf(edges) <= memoryBudget;
+    }
+
+    void clear() {
+        entries.clear();
+        recency.clear();
+        bytesHeld = 0;
+    }
+
+    [[nodiscard]] size_t getMemoryHits() const { return memoryHits; }
+    [[nodiscard]] size_t getDiskHits() const { return diskHits; }
+    [[nodiscard]] size_t getGeneratedCount() const { return generated; }
+    [[nodiscard]] size_t getBytesHeld() const { return bytesHeld; }
+
+private:
+    // Snapshots of every generator version count against the disk budget
+    static constexpr const char* FILE_PREFIX = "graph-v";
+
+    // Source, destination and weight column of every edge
+    static size_t sizeOf(const size_t edges) {
+        return sizeof(GraphData) + edges * 3 * sizeof(int);
+    }
+
+    void insert(const GraphCacheKey& key, std::shared_ptr<const GraphData> graph) {
+        const size_t bytes = sizeOf(graph->edges.size());
+        while (!recency.empty() && bytesHeld + bytes > memoryBudget) {
+            const auto evicted = entries.find(recency.back());
+            bytesHeld -= evicted->second.bytes;
+            entries.erase(evicted);
+            recency.pop_back();
+        }
+
+        recency.push_front(key);
+        entries.emplace(key, Entry{std::move(graph), bytes, recency.begin()});
+        bytesHeld += bytes;
+    }
+
+    [[nodiscard]] std::filesystem::path pathOf(const GraphCacheKey& key) const {
+        return directory / (std::string(FILE_PREFIX) + std::to_string(RandomGraphGenerator::VERSION) + "-"
+                            + RandomGraphGenerator::familyName(key.family) + "-" + std::to_string(key.vertices)
+                            + "-" + std::to_string(key.density) + (key.directed ? "-directed-" : "-undirected-")
+                            + std::to_string(key.seed) + ".snap");
+    }
+
+    // A missing or unreadable file is only a miss - the graph is generated again
+    std::shared_ptr<const GraphData> load(const GraphCacheKey& key) const {
+        if (directory.empty()) return nullptr;
+
+        const auto path = pathOf(key);
+        std::error_code error;
+        if (!std::filesystem::exists(path, error)) return nullptr;
+
+        try {
+            const MappedFile file(path.string());
+            auto graph = std::make_shared<const GraphData>(GraphSnapshot::toGraphData(file.data(), file.size(), path.string()));
+            std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+            return graph;
+        } catch (const std::exception& e) {
+            std::cerr << "Ignoring cached graph " << path << ": " << e.what() << std::endl;
+            return nullptr;
+        }
+    }
+
+    // Written under a temporary name and renamed, so an interrupted run never leaves half a snapshot behind
+    void store(const GraphCacheKey& key, const GraphData& graph) const {
+        if (directory.empty()) return;
+
+        const auto path = pathOf(key);
+        auto temporary = path;
+        temporary += ".tmp";
+        try {
+            std::filesystem::create_directories(directory);
+            GraphSnapshot::write(temporary.string(), graph);
+            std::filesystem::rename(temporary, path);
+            trim();
+        } catch (const std::exception& e) {
+            std::error_code ignored;
+            std::filesystem::remove(temporary, ignored);
+            std::cerr << "Could not store generated graph in " << directory << ": " << e.what() << std::endl;
+        }
+    }
+
+    // Removes snapshots, the one used longest ago first, until the directory fits the disk budget again.
+    // A snapshot larger than the whole budget is removed right after it was written.
+    void trim() const {
+        struct StoredFile {
+            std::filesystem::file_time_type used;
+            uintmax_t bytes;
+            std::filesystem::path path;
+        };
+
+        std::vector<StoredFile> files;
+        uintmax_t total = 0;
+        for (const auto& file : std::filesystem::directory_iterator(directory)) {
+            const auto name = file.path().filename().string();
+            if (!file.is_regular_file() || !name.starts_with(FILE_PREFIX) || !name.ends_with(".snap")) continue;
+
+            files.push_back({file.last_write_time(), file.file_size(), file.path()});
+            total += files.back().bytes;
+        }
+
+        std::sort(files.begin(), files.end(), [](const StoredFile& a, const StoredFile& b) { return a.used < b.used; });
+        for (size_t i = 0; i < files.size() && total > diskBudget; i++) {
+            std::error_code error;
+            if (std::filesystem::remove(files[i].path, error)) {
+                total -= files[i].bytes;
+            }
+        }
+    }
+};
+
+#endif //GRAPHCACHE_H
@@ -2,58 +2,124 @@
 #define GRAPHCONVERTER_H
 #include <iomanip>
 #include <iostream>
-#include <memory>
+#include <stdexcept>
+#include <algorithm>
+#include <limits>
 
 #include "../Utils/Enums/GraphRepresentationType.h"
-
-class AdjacencyMatrix;
-class AdjacencyList;
+#include "../Utils/Enums/MemoryPolicy.h"
+#include "../Utils/Representations/GraphVariant.h"
+#include "../Utils/Representations/WeightTraits.h"
 
 class GraphConverter {
 public:
-    static std::unique_ptr<GraphRepresentation> ConvertToRepresenstation(const GraphData& data, const bool isDirected, const GraphRepresentationType type)
+    // Stores weights in the narrowest type that holds every weight of the graph
+    template<bool Directed, typename DataWeight>
+    static GraphVariant<Directed> ConvertToRepresenstation(const WeightedGraphData<DataWeight>& data, const GraphRepresentationType type)
+    {
+        long long minWeight = 0;
+        long long maxWeight = 0;
+        getWeightRange(data, minWeight, maxWeight);
+
+        if (WeightTraits<uint8_t>::fits(minWeight, maxWeight)) {
+            return ConvertWithWeight<Directed, uint8_t>(data, type);
+        }
+        if (WeightTraits<uint16_t>::fits(minWeight, maxWeight)) {
+            return ConvertWithWeight<Directed, uint16_t>(data, type);
+        }
+        return ConvertWithWeight<Directed, int>(data, type);
+    }
+
+    template<bool Directed, typename Weight, typename DataWeight>
+    static GraphVariant<Directed> ConvertWithWeight(const WeightedGraphData<DataWeight>& data, const GraphRepresentationType type)
     {
         switch (type)
         {
             case GraphRepresentationType::ADJACENCY_LIST:
-                return graphDataToAdjList(data, isDirected);
+                return graphDataToAdjList<Directed, Weight>(data);
             case GraphRepresentationType::ADJACENCY_MATRIX:
-                return graphDataToAdjMatrix(data, isDirected);
+                return graphDataToAdjMatrix<Directed, Weight>(data);
         }
+        throw std::invalid_argument("Unknown graph representation");
     }
 
-    static std::unique_ptr<AdjacencyList> graphDataToAdjList(const GraphData& data, bool isDirected) {
-        auto adjList = std::make_unique<AdjacencyList>(data.numVertices, isDirected);
+    // int is enough when even the sum of all weights fits, which bounds every path length, tree weight and flow value
+    template<typename DataWeight>
+    static AccumulatorVariant ChooseAccumulator(const WeightedGraphData<DataWeight>& data)
+    {
+        long long minWeight = 0;
+        long long maxWeight = 0;
+        getWeightRange(data, minWeight, maxWeight);
 
-        for (const auto& edge : data.edges) {
-            adjList->addEdge(edge.first(), edge.second(), edge.third());
+        return ChooseAccumulator(static_cast<long long>(data.edges.size()), minWeight, maxWeight);
+    }
+
+    // The same choice from the edge count and weight bounds alone, for graphs that never existed as GraphData
+    static AccumulatorVariant ChooseAccumulator(const long long edgeCount, const long long minWeight, const long long maxWeight)
+    {
+        const long long largestWeight = std::max(maxWeight, -minWeight);
+        if (largestWeight == 0 || edgeCount <= std::numeric_limits<int>::max() / largestWeight) {
+            return AccumulatorVariant(std::in_place_type<int>);
         }
+        return AccumulatorVariant(std::in_place_type<int64_t>);
+    }
+
+    template<typename DataWeight>
+    static void getWeightRange(const WeightedGraphData<DataWeight>& data, long long& minWeight, long long& maxWeight) {
+        bool first = true;
+        for (const auto weightValue : data.edges.getWeights()) {
+            const auto weight = static_cast<long long>(weightValue);
+            if (first || weight < minWeight) minWeight = weight;
+            if (first || weight > maxWeight) maxWeight = weight;
+            first = false;
+        }
+    }
+
+    // Undirected representations mirror every edge themselves, directed ones get both arcs of an undirected edge here
+    template<bool Directed, typename Weight, typename Graph, typename DataWeight>
+    static void addEdges(Graph& graph, const WeightedGraphData<DataWeight>& data) {
+        const bool mirror = Directed && data.isUndirected;
+        data.edges.forEach([&](int source, int destination, DataWeight weight) {
+            graph.addEdge(source, destination, static_cast<Weight>(weight));
+            if (mirror) {
+                graph.addEdge(destination, source, static_cast<Weight>(weight));
+            }
+        });
+    }
+
+    template<bool Directed, typename Weight = int, typename DataWeight>
+    static AdjacencyList<Directed, Weight> graphDataToAdjList(const WeightedGraphData<DataWeight>& data) {
+        AdjacencyList<Directed, Weight> adjList(data.numVertices);
+
+        addEdges<Directed, Weight>(adjList, data);
 
         return adjList;
     }
 
-    static std::unique_ptr<AdjacencyMatrix> graphDataToAdjMatrix(const GraphData& data, bool isDirected) {
-        auto adjMatrix = std::make_unique<AdjacencyMatrix>(data.numVertices, isDirected);
+    template<bool Directed, typename Weight = int, typename DataWeight>
+    static AdjacencyMatrix<Directed, Weight> graphDataToAdjMatrix(const WeightedGraphData<DataWeight>& data,
+                                                                  const MemoryPolicy memory = MemoryPolicy::STANDARD) {
+        AdjacencyMatrix<Directed, Weight> adjMatrix(data.numVertices, memory);
 
-        for (const auto& edge : data.edges) {
-            adjMatrix->addEdge(edge.first(), edge.second(), edge.third());
-        }
+        addEdges<Directed, Weight>(adjMatrix, data);
 
         return adjMatrix;
     }
 
-    static void printAdjacencyList(const AdjacencyList& graph) {
+    template<bool Directed, typename Weight>
+    static void printAdjacencyList(const AdjacencyList<Directed, Weight>& graph) {
         std::cout << "Adjacency List Representation:\n";
         for (int i = 0; i < graph.getVertexCount(); ++i) {
             std::cout << "Vertex " << i << ": ";
             for (const auto& edge : graph.getAdjacent(i)) {
-                std::cout << "(" << edge.destination << ", weight: " << edge.weight << ") ";
+                std::cout << "(" << edge.destination << ", weight: " << static_cast<int>(edge.weight) << ") ";
             }
             std::cout << "\n";
         }
     }
 
-    static void printAdjacencyMatrix(const AdjacencyMatrix& graph) {
+    template<bool Directed, typename Weight>
+    static void printAdjacencyMatrix(const AdjacencyMatrix<Directed, Weight>& graph) {
         std::cout << "Adjacency Matrix Representation:\n";
         std::cout << "   ";
         for (int i = 0; i < graph.getVertexCount(); ++i) {
@@ -0,0 +1,392 @@
+#ifndef GRAPHFAMILYGENERATOR_H
+#define GRAPHFAMILYGENERATOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include "../Utils/GraphData.h"
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotABitset.h"
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "../Utils/DefinitelyNotADataStructures/UnionFind.h"
+#include "../Utils/Enums/GraphFamily.h"
+#include "../Utils/Parallel/ParallelFor.h"
+#include "../Utils/Random/CounterRandom.h"
+
+/**
+ * Graphs with the degree structure of real inputs rather than uniform random ones: skewed R-MAT, road-like lattices,
+ * preferential attachment and random geometric graphs. Like the uniform generator everything is drawn from
+ * CounterRandom streams of the seed, so the graph depends on the seed alone and not on the thread count.
+ * Edges are collected as sorted (source, destination) keys; components left apart by the family are then joined by
+ * one edge each, so every algorithm sees a connected graph.
+ */
+class GraphFamilyGenerator {
+private:
+    uint64_t seed;
+    int threads;
+
+    // Separate seeds per purpose, so e.g. the weights of an edge do not depend on how its endpoints were drawn
+    static constexpr uint64_t LABEL_SALT = 0x6c6162656c73ULL;
+    static constexpr uint64_t TOPOLOGY_SALT = 0x746f706f6c6f6779ULL;
+    static constexpr uint64_t WEIGHT_SALT = 0x77656967687473ULL;
+
+    // Graph500 quadrant probabilities 0.57, 0.19, 0.19 as cumulative 16-bit thresholds -
+    // the remaining 0.05 goes to the bottom right quadrant
+    static constexpr uint32_t RMAT_A = 37356;   // 0.57 * 65536
+    static constexpr uint32_t RMAT_AB = 49807;  // 0.76 * 65536
+    static constexpr uint32_t RMAT_ABC = 62259; // 0.95 * 65536
+    // Sampling rounds before a dense R-MAT target is given up - the skew keeps hitting the cells it already has
+    static constexpr int RMAT_ROUNDS = 16;
+    static constexpr int RMAT_ATTEMPTS = 64;
+    static constexpr uint64_t NO_KEY = UINT64_MAX;
+
+    // Pairs sampled to pick the radius of a geometric graph
+    static constexpr int RADIUS_SAMPLES = 1 << 16;
+
+public:
+    GraphFamilyGenerator(const uint64_t seed, const int threads) : seed(seed), threads(std::max(1, threads)) {}
+
+    /**
+     * targetEdges is what the uniform generator would produce for the same density. R-MAT, power-law and geometric
+     * graphs aim for it (directed power-law, grid and geometric graphs are symmetric, so each edge is two arcs);
+     * lattices ignore it, their edge count is fixed by the vertex count.
+     */
+    [[nodiscard]] GraphData generate(const GraphFamily family, const int vertices, const int64_t targetEdges,
+                                     const bool isDirected, const int minWeight, const int maxWeight) const {
+        const int64_t targetPairs = isDirected ? targetEdges / 2 : targetEdges;
+        auto randomWeight = [&](const int u, const int v) {
+            return CounterRandom(purposeSeed(WEIGHT_SALT), key(u, v)).between(minWeight, maxWeight);
+        };
+
+        switch (family) {
+            case GraphFamily::RMAT: {
+                auto keys = rmatEdges(vertices, targetEdges, isDirected);
+                return finish(keys, vertices, isDirected, !isDirected, randomWeight);
+            }
+            case GraphFamily::GRID_2D:
+            case GraphFamily::GRID_3D: {
+                auto keys = gridEdges(vertices, family == GraphFamily::GRID_3D ? 3 : 2);
+                // Road-like: every street costs about the same, give or take a quarter of the weight range
+                const int middle = minWeight + (maxWeight - minWeight) / 2;
+                const int spread = (maxWeight - minWeight) / 4;
+                return finish(keys, vertices, isDirected, true, [&](const int u, const int v) {
+                    return CounterRandom(purposeSeed(WEIGHT_SALT), key(u, v)).between(middle - spread, middle + spread);
+                });
+            }
+            case GraphFamily::POWER_LAW: {
+                auto keys = preferentialAttachmentEdges(vertices, targetPairs);
+                return finish(keys, vertices, isDirected, true, randomWeight);
+            }
+            case GraphFamily::GEOMETRIC: {
+                DefinitelyNotAVector<double> x;
+                DefinitelyNotAVector<double> y;
+                double radius = 0;
+                auto keys = geometricEdges(vertices, targetPairs, x, y, radius);
+                // Weight grows with the distance, an edge of length radius (or a longer joining edge) costs maxWeight
+                return finish(keys, vertices, isDirected, true, [&](const int u, const int v) {
+                    const double length = std::hypot(x[u] - x[v], y[u] - y[v]);
+                    const double share = radius > 0 ? std::min(1.0, length / radius) : 1.0;
+                    return minWeight + static_cast<int>(std::lround(share * (static_cast<double>(maxWeight) - minWeight)));
+                });
+            }
+            case GraphFamily::UNIFORM:
+                break;
+        }
+        throw std::invalid_argument("Graph family is not generated by GraphFamilyGenerator");
+    }
+
+private:
+    [[nodiscard]] uint64_t purposeSeed(const uint64_t salt) const {
+        return CounterRandom::mix(seed ^ salt);
+    }
+
+    static uint64_t key(const int source, const int destination) {
+        return static_cast<uint64_t>(source) << 32 | static_cast<uint32_t>(destination);
+    }
+
+    static uint64_t undirectedKey(const int u, const int v) {
+        return u < v ? key(u, v) : key(v, u);
+    }
+
+    static int sourceOf(const uint64_t edge) { return static_cast<int>(edge >> 32); }
+    static int destinationOf(const uint64_t edge) { return static_cast<int>(edge & 0xffffffffU); }
+
+    static uint64_t below(CounterRandom& random, const uint64_t bound) {
+        return bound <= UINT32_MAX ? random.below(static_cast<uint32_t>(bound)) : random.next() % bound;
+    }
+
+    // Random relabelling, so hubs and lattice neighbours are not also neighbours in vertex order
+    [[nodiscard]] DefinitelyNotAVector<int> shuffledLabels(const int vertices) const {
+        CounterRandom random(purposeSeed(LABEL_SALT), 0);
+        DefinitelyNotAVector<int> labels(vertices);
+        for (int i = 0; i < vertices; i++) labels[i] = i;
+        for (int i = vertices - 1; i > 0; i--) {
+            std::swap(labels[i], labels[random.below(static_cast<uint32_t>(i) + 1)]);
+        }
+        return labels;
+    }
+
+    static void sortUnique(DefinitelyNotAVector<uint64_t>& keys) {
+        std::sort(keys.begin(), keys.end());
+        keys.resize(static_cast<size_t>(std::unique(keys.begin(), keys.end()) - keys.begin()));
+    }
+
+    /**
+     * Graph500 R-MAT: each edge descends log2(V) levels of the adjacency matrix, picking a quadrant per level.
+     * Edge i draws from its own stream, so rounds fill in parallel; endpoints past V or self-loops are redrawn.
+     * Rounds draw the edges still missing until the target is met or a round adds almost nothing new.
+     */
+    [[nodiscard]] DefinitelyNotAVector<uint64_t> rmatEdges(const int vertices, const int64_t targetEdges, const bool isDirected) const {
+        int scale = 0;
+        while ((int64_t(1) << scale) < vertices) scale++;
+
+        const auto labels = shuffledLabels(vertices);
+        const uint64_t topologySeed = purposeSeed(TOPOLOGY_SALT);
+        auto drawEdge = [&](const uint64_t index) {
+            CounterRandom random(topologySeed, index);
+            for (int attempt = 0; attempt < RMAT_ATTEMPTS; attempt++) {
+                int64_t u = 0;
+                int64_t v = 0;
+                uint64_t bits = 0;
+                for (int level = 0; level < scale; level++) {
+                    // 16 random bits per level, so one draw covers four levels
+                    if (level % 4 == 0) bits = random.next();
+                    const auto r = static_cast<uint32_t>(bits & 0xffff);
+                    bits >>= 16;
+                    u = 2 * u + (r >= RMAT_AB ? 1 : 0);
+                    v = 2 * v + ((r >= RMAT_A && r < RMAT_AB) || r >= RMAT_ABC ? 1 : 0);
+                }
+                if (u < vertices && v < vertices && u != v) {
+                    const int source = labels[u];
+                    const int destination = labels[v];
+                    return isDirected ? key(source, destination) : undirectedKey(source, destination);
+                }
+            }
+            return NO_KEY;
+        };
+
+        DefinitelyNotAVector<uint64_t> keys;
+        const auto target = static_cast<size_t>(targetEdges);
+        uint64_t drawn = 0;
+        for (int round = 0; round < RMAT_ROUNDS && keys.size() < target; round++) {
+            const size_t before = keys.size();
+            const size_t missing = target - before;
+            keys.resize(before + missing);
+            ParallelFor::run(missing, threads, 1024, [&](int, const size_t begin, const size_t end) {
+                for (size_t i = begin; i < end; i++) {
+                    keys[before + i] = drawEdge(drawn + i);
+                }
+            });
+            drawn += missing;
+
+            std::sort(keys.begin() + before, keys.end());
+            std::inplace_merge(keys.begin(), keys.begin() + before, keys.end());
+            keys.resize(static_cast<size_t>(std::unique(keys.begin(), keys.end()) - keys.begin()));
+            if (!keys.empty() && keys.back() == NO_KEY) keys.pop_back();
+
+            if (keys.size() - before <= missing / 100) break;
+        }
+        return keys;
+    }
+
+    // Vertex i sits at coordinate i in a lattice of side ceil(V^(1/dimensions)) and is joined to its next neighbour
+    // along every axis; the last layer may be partly filled, but every vertex in it still has its neighbour below
+    static DefinitelyNotAVector<uint64_t> gridEdges(const int vertices, const int dimensions) {
+        int64_t side = 1;
+        while ((dimensions == 2 ? side * side : side * side * side) < vertices) side++;
+
+        DefinitelyNotAVector<uint64_t> keys;
+        keys.reserve(static_cast<size_t>(vertices) * dimensions);
+        for (int64_t v = 0; v < vertices; v++) {
+            int64_t stride = 1;
+            for (int axis = 0; axis < dimensions; axis++, stride *= side) {
+                const bool lastOnAxis = (v / stride) % side == side - 1;
+                if (!lastOnAxis && v + stride < vertices) {
+                    keys.push_back(key(static_cast<int>(v), static_cast<int>(v + stride)));
+                }
+            }
+        }
+        std::sort(keys.begin(), keys.end());
+        return keys;
+    }
+
+    /**
+     * Barabasi-Albert: vertex t joins m earlier vertices, each picked with probability proportional to its degree -
+     * a uniform draw from the list holding every edge endpoint. m is the target edge count per vertex.
+     */
+    [[nodiscard]] DefinitelyNotAVector<uint64_t> preferentialAttachmentEdges(const int vertices, const int64_t targetEdges) const {
+        const auto m = static_cast<int>(std::clamp<int64_t>((targetEdges + vertices / 2) / std::max(vertices, 1), 1,
+                                                             std::max(vertices - 1, 1)));
+        const auto labels = shuffledLabels(vertices);
+        CounterRandom random(purposeSeed(TOPOLOGY_SALT), 0);
+
+        DefinitelyNotAVector<uint64_t> keys;
+        DefinitelyNotAVector<int> endpoints;
+        keys.reserve(static_cast<size_t>(m) * vertices);
+        endpoints.reserve(2 * static_cast<size_t>(m) * vertices);
+        DefinitelyNotABitset chosen(vertices);
+        DefinitelyNotAVector<int> picked;
+
+        for (int t = 1; t < vertices; t++) {
+            picked.clear();
+            if (t <= m) {
+                for (int c = 0; c < t; c++) picked.push_back(c);
+            } else {
+                while (static_cast<int>(picked.size()) < m) {
+                    const int candidate = endpoints[below(random, endpoints.size())];
+                    if (!chosen.test(candidate)) {
+                        chosen.set(candidate);
+                        picked.push_back(candidate);
+                    }
+                }
+            }
+
+            for (const int c : picked) {
+                keys.push_back(undirectedKey(labels[t], labels[c]));
+                endpoints.push_back(t);
+                endpoints.push_back(c);
+                chosen.reset(c);
+            }
+        }
+        sortUnique(keys);
+        return keys;
+    }
+
+    /**
+     * Points uniform in the unit square, joined when closer than a radius. The radius is the distance quantile of
+     * sampled pairs that matches the target density. Points are bucketed in cells at least a radius wide,
+     * so each point only checks its own and the 8 surrounding cells.
+     */
+    [[nodiscard]] DefinitelyNotAVector<uint64_t> geometricEdges(const int vertices, const int64_t targetEdges,
+                                                                DefinitelyNotAVector<double>& x, DefinitelyNotAVector<double>& y,
+                                                                double& radius) const {
+        const uint64_t topologySeed = purposeSeed(TOPOLOGY_SALT);
+        x = DefinitelyNotAVector<double>(vertices);
+        y = DefinitelyNotAVector<double>(vertices);
+        for (int i = 0; i < vertices; i++) {
+            CounterRandom random(topologySeed, static_cast<uint64_t>(i) + 1);
+            x[i] = random.unit();
+            y[i] = random.unit();
+        }
+
+        const int64_t pairs = static_cast<int64_t>(vertices) * (vertices - 1) / 2;
+        radius = pairs == 0 || targetEdges >= pairs ? std::sqrt(2.0) : sampledRadius(x, y, static_cast<double>(targetEdges) / pairs);
+
+        const auto cellsPerSide = static_cast<int>(std::clamp(std::floor(1.0 / std::max(radius, 1e-9)), 1.0,
+                                                              std::max(1.0, std::sqrt(static_cast<double>(vertices)))));
+        auto cellOf = [&](const double coordinate) {
+            return std::min(cellsPerSide - 1, static_cast<int>(coordinate * cellsPerSide));
+        };
+
+        // Counting sort of the points by cell
+        const size_t cellCount = static_cast<size_t>(cellsPerSide) * cellsPerSide;
+        DefinitelyNotAVector<int> cellStart(cellCount + 1, 0);
+        for (int i = 0; i < vertices; i++) {
+            cellStart[static_cast<size_t>(cellOf(y[i])) * cellsPerSide + cellOf(x[i]) + 1]++;
+        }
+        for (size_t c = 0; c < cellCount; c++) cellStart[c + 1] += cellStart[c];
+        DefinitelyNotAVector<int> byCell(vertices);
+        DefinitelyNotAVector<int> fill(cellStart);
+        for (int i = 0; i < vertices; i++) {
+            byCell[fill[static_cast<size_t>(cellOf(y[i])) * cellsPerSide + cellOf(x[i])]++] = i;
+        }
+
+        const double radiusSquared = radius * radius;
+        DefinitelyNotAVector<DefinitelyNotAVector<uint64_t>> found(static_cast<size_t>(threads));
+        ParallelFor::run(vertices, threads, 64, [&](const int thread, const size_t begin, const size_t end) {
+            auto& out = found[thread];
+            for (size_t i = begin; i < end; i++) {
+                const int cx = cellOf(x[i]);
+                const int cy = cellOf(y[i]);
+                for (int ny = std::max(0, cy - 1); ny <= std::min(cellsPerSide - 1, cy + 1); ny++) {
+                    for (int nx = std::max(0, cx - 1); nx <= std::min(cellsPerSide - 1, cx + 1); nx++) {
+                        const size_t cell = static_cast<size_t>(ny) * cellsPerSide + nx;
+                        for (int k = cellStart[cell]; k < cellStart[cell + 1]; k++) {
+                            const int j = byCell[k];
+                            const double dx = x[i] - x[j];
+                            const double dy = y[i] - y[j];
+                            if (j > static_cast<int>(i) && dx * dx + dy * dy <= radiusSquared) {
+                                out.push_back(key(static_cast<int>(i), j));
+                            }
+                        }
+                    }
+                }
+            }
+        });
+
+        DefinitelyNotAVector<uint64_t> keys;
+        size_t total = 0;
+        for (const auto& part : found) total += part.size();
+        keys.reserve(total);
+        for (const auto& part : found) {
+            for (const uint64_t edge : part) keys.push_back(edge);
+        }
+        std::sort(keys.begin(), keys.end());
+        return keys;
+    }
+
+    // Distance below which the wanted share of sampled pairs lies
+    [[nodiscard]] double sampledRadius(const DefinitelyNotAVector<double>& x, const DefinitelyNotAVector<double>& y,
+                                       const double share) const {
+        const auto vertices = static_cast<uint32_t>(x.size());
+        CounterRandom random(purposeSeed(TOPOLOGY_SALT), 0);
+        DefinitelyNotAVector<double> distances;
+        distances.reserve(RADIUS_SAMPLES);
+        while (static_cast<int>(distances.size()) < RADIUS_SAMPLES) {
+            const uint32_t i = random.below(vertices);
+            const uint32_t j = random.below(vertices);
+            if (i != j) distances.push_back(std::hypot(x[i] - x[j], y[i] - y[j]));
+        }
+
+        const auto rank = std::clamp<int64_t>(static_cast<int64_t>(std::ceil(share * RADIUS_SAMPLES)) - 1, 0, RADIUS_SAMPLES - 1);
+        std::nth_element(distances.begin(), distances.begin() + rank, distances.end());
+        return distances[rank];
+    }
+
+    /**
+     * Joins the components of the sorted keys in a chain through their smallest vertices and writes the graph.
+     * Symmetric keys hold each pair once (smaller vertex first); a directed graph then gets both arcs of it.
+     */
+    template<typename WeightOf>
+    static GraphData finish(DefinitelyNotAVector<uint64_t>& keys, const int vertices, const bool isDirected,
+                            const bool symmetric, WeightOf&& weightOf) {
+        UnionFind components(vertices);
+        for (const uint64_t edge : keys) {
+            components.unite(sourceOf(edge), destinationOf(edge));
+        }
+
+        if (components.getCount() > 1) {
+            DefinitelyNotABitset seen(vertices);
+            int previous = -1;
+            for (int v = 0; v < vertices; v++) {
+                const int root = components.find(v);
+                if (seen.test(root)) continue;
+                seen.set(root);
+                if (previous >= 0) {
+                    keys.push_back(key(previous, v));
+                    if (!symmetric) keys.push_back(key(v, previous));
+                }
+                previous = v;
+            }
+            std::sort(keys.begin(), keys.end());
+        }
+
+        GraphData graph;
+        graph.numVertices = vertices;
+        graph.isUndirected = !isDirected;
+        const bool mirror = symmetric && isDirected;
+        graph.edges.reserve(keys.size() * (mirror ? 2 : 1));
+        for (const uint64_t edge : keys) {
+            const int source = sourceOf(edge);
+            const int destination = destinationOf(edge);
+            graph.edges.add(source, destination, weightOf(source, destination));
+            if (mirror) {
+                graph.edges.add(destination, source, weightOf(destination, source));
+            }
+        }
+        graph.numEdges = static_cast<int64_t>(graph.edges.size());
+        return graph;
+    }
+};
+
+#endif //GRAPHFAMILYGENERATOR_H
@@ -0,0 +1,389 @@
+#ifndef GRAPHIMPORTER_H
+#define GRAPHIMPORTER_H
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include "../Utils/Enums/GraphFileFormat.h"
+#include "../Utils/GraphData.h"
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "GraphSnapshot.h"
+#include "IntegerScanner.h"
+
+/**
+ * Streaming parsers for the common benchmark graph formats, run straight over a mapped file.
+ * Vertices are renumbered from 0, undirected formats store every edge once with isUndirected set,
+ * and unweighted formats get weight 1.
+ */
+class GraphImporter {
+public:
+    // Content first (the formats announce themselves), then the file extension
+    static GraphFileFormat detectFormat(const std::string& fileName, const char* data, const size_t size) {
+        if (GraphSnapshot::isSnapshot(data, size)) return GraphFileFormat::SNAPSHOT;
+
+        const std::string_view text(data, size);
+        if (text.starts_with("%%MatrixMarket")) return GraphFileFormat::MATRIX_MARKET;
+        if (text.starts_with("c ") || text.starts_with("c\n") || text.starts_with("p ")) return GraphFileFormat::DIMACS;
+        if (text.starts_with("#")) return GraphFileFormat::SNAP;
+
+        const std::string_view name(fileName);
+        if (name.ends_with(".gr") || name.ends_with(".max")) return GraphFileFormat::DIMACS;
+        if (name.ends_with(".graph") || name.ends_with(".metis")) return GraphFileFormat::METIS;
+        if (name.ends_with(".mtx")) return GraphFileFormat::MATRIX_MARKET;
+        if (name.ends_with(".edges") || name.ends_with(".el")) return GraphFileFormat::SNAP;
+        return GraphFileFormat::NATIVE;
+    }
+
+    static GraphData parse(const char* data, const size_t size, const GraphFileFormat format) {
+        switch (format) {
+            case GraphFileFormat::DIMACS:
+                return parseDimacs(data, size);
+            case GraphFileFormat::METIS:
+                return parseMetis(data, size);
+            case GraphFileFormat::MATRIX_MARKET:
+                return parseMatrixMarket(data, size);
+            case GraphFileFormat::SNAP:
+                return parseSnap(data, size);
+            default:
+                throw std::invalid_argument("Format has no importer");
+        }
+    }
+
+private:
+    // Lines of a character range, without the line break
+    class LineCursor {
+    private:
+        const char* position;
+        const char* last;
+
+    public:
+        LineCursor(const char* begin, const char* end) : position(begin), last(end) {}
+
+        bool next(std::string_view& line) {
+            if (position == last) return false;
+            const char* end = std::find(position, last, '\n');
+            const char* trimmed = end > position && end[-1] == '\r' ? end - 1 : end;
+            line = std::string_view(position, static_cast<size_t>(trimmed - position));
+            position = end < last ? end + 1 : last;
+            return true;
+        }
+    };
+
+    static IntegerScanner scannerOf(const std::string_view line, const size_t skip, const char* origin) {
+        return IntegerScanner(line.data() + std::min(skip, line.size()), line.data() + line.size(), origin);
+    }
+
+    // Word at the front of text, text is advanced past it
+    static std::string_view nextWord(std::string_view& text) {
+        const size_t begin = text.find_first_not_of(" \t");
+        if (begin == std::string_view::npos) {
+            text = {};
+            return {};
+        }
+        const size_t end = std::min(text.find_first_of(" \t", begin), text.size());
+        const std::string_view word = text.substr(begin, end - begin);
+        text.remove_prefix(end);
+        return word;
+    }
+
+    static std::runtime_error malformedLine(const char* origin, const std::string_view line) {
+        return std::runtime_error("Malformed line at byte " + std::to_string(line.data() - origin));
+    }
+
+    static int vertexFromOne(const long long id, const int vertices, const char* origin, const std::string_view line) {
+        if (id < 1 || id > vertices) {
+            throw std::runtime_error("Vertex out of range at byte " + std::to_string(line.data() - origin));
+        }
+        return static_cast<int>(id - 1);
+    }
+
+    /**
+     * DIMACS: "p sp|max V E" header, "a u v w" arcs, "n id s|t" source and sink of max-flow files;
+     * "p edge" files with "e u v" lines are read as undirected and unweighted.
+     */
+    static GraphData parseDimacs(const char* data, const size_t size) {
+        GraphData graphData;
+        bool headerRead = false;
+
+        LineCursor lines(data, data + size);
+        std::string_view line;
+        while (lines.next(line)) {
+            if (line.empty() || line[0] == 'c') continue;
+
+            if (line[0] == 'p') {
+                std::string_view rest = line.substr(1);
+                const std::string_view problem = nextWord(rest);
+                long long vertices = 0;
+                long long edges = 0;
+                IntegerScanner scanner = scannerOf(line, line.size() - rest.size(), data);
+                if (problem.empty() || !scanner.next(vertices) || !scanner.next(edges) || vertices < 0 || edges < 0
+                    || vertices > std::numeric_limits<int>::max()) {
+                    throw malformedLine(data, line);
+                }
+                graphData.numVertices = static_cast<int>(vertices);
+                graphData.isUndirected = problem == "edge" || problem == "col";
+                graphData.edges.reserve(static_cast<size_t>(edges));
+                headerRead = true;
+                continue;
+            }
+
+            if (!headerRead) {
+                throw std::runtime_error("DIMACS line before the problem line at byte " + std::to_string(line.data() - data));
+            }
+
+            IntegerScanner scanner = scannerOf(line, 1, data);
+            long long u = 0;
+            long long v = 0;
+            int weight = 1;
+            switch (line[0]) {
+                case 'a':
+                    if (!scanner.next(u) || !scanner.next(v) || !scanner.next(weight)) throw malformedLine(data, line);
+                    graphData.edges.add(vertexFromOne(u, graphData.numVertices, data, line),
+                                        vertexFromOne(v, graphData.numVertices, data, line), weight);
+                    break;
+                case 'e':
+                    if (!scanner.next(u) || !scanner.next(v)) throw malformedLine(data, line);
+                    graphData.edges.add(vertexFromOne(u, graphData.numVertices, data, line),
+                                        vertexFromOne(v, graphData.numVertices, data, line), 1);
+                    break;
+                case 'n': {
+                    if (!scanner.next(u)) throw malformedLine(data, line);
+                    std::string_view rest(scanner.current(), static_cast<size_t>(line.data() + line.size() - scanner.current()));
+                    const std::string_view designator = nextWord(rest);
+                    const int vertex = vertexFromOne(u, graphData.numVertices, data, line);
+                    if (designator == "s") {
+                        graphData.startVertex = vertex;
+                    } else if (designator == "t") {
+                        graphData.endVertex = vertex;
+                    } else {
+                        throw malformedLine(data, line);
+                    }
+                    break;
+                }
+                default:
+                    throw malformedLine(data, line);
+            }
+        }
+
+        if (!headerRead) {
+            throw std::runtime_error("DIMACS file has no problem line");
+        }
+        graphData.numEdges = static_cast<int64_t>(graphData.edges.size());
+        return graphData;
+    }
+
+    /**
+     * METIS: "n m [fmt [ncon]]" header, then one line per vertex listing its 1-based neighbours.
+     * fmt digits enable vertex sizes (100), ncon vertex weights (10) and edge weights (1); only edge weights are kept.
+     * Every edge is listed from both ends and stored once. Empty lines are vertices without neighbours.
+     */
+    static GraphData parseMetis(const char* data, const size_t size) {
+        LineCursor lines(data, data + size);
+        std::string_view line;
+        auto nextContentLine = [&]() {
+            while (lines.next(line)) {
+                if (line.empty() || line[0] != '%') return true;
+            }
+            return false;
+        };
+
+        // Header, skipping leading blank lines as well
+        do {
+            if (!nextContentLine()) throw std::runtime_error("METIS file has no header");
+        } while (line.find_first_not_of(" \t") == std::string_view::npos);
+
+        IntegerScanner header = scannerOf(line, 0, data);
+        long long vertices = 0;
+        long long edges = 0;
+        int format = 0;
+        int constraints = 1;
+        if (!header.next(vertices) || !header.next(edges) || vertices < 0 || edges < 0
+            || vertices > std::numeric_limits<int>::max()) {
+            throw malformedLine(data, line);
+        }
+        if (header.next(format)) {
+            header.next(constraints);
+        }
+        const bool vertexSizes = format / 100 % 10 != 0;
+        const bool vertexWeights = format / 10 % 10 != 0;
+        const bool edgeWeights = format % 10 != 0;
+
+        GraphData graphData;
+        graphData.numVertices = static_cast<int>(vertices);
+        graphData.isUndirected = true;
+        graphData.edges.reserve(static_cast<size_t>(edges));
+
+        for (int u = 0; u < graphData.numVertices; u++) {
+            if (!nextContentLine()) {
+                throw std::runtime_error("METIS file ended after " + std::to_string(u) + " of "
+                                         + std::to_string(graphData.numVertices) + " vertices");
+            }
+
+            IntegerScanner scanner = scannerOf(line, 0, data);
+            long long ignored = 0;
+            const int skipped = (vertexSizes ? 1 : 0) + (vertexWeights ? constraints : 0);
+            for (int i = 0; i < skipped; i++) {
+                if (!scanner.next(ignored)) throw malformedLine(data, line);
+            }
+
+            long long neighbour = 0;
+            while (scanner.next(neighbour)) {
+                int weight = 1;
+                if (edgeWeights && !scanner.next(weight)) throw malformedLine(data, line);
+                const int v = vertexFromOne(neighbour, graphData.numVertices, data, line);
+                if (u <= v) {
+                    graphData.edges.add(u, v, weight);
+                }
+            }
+        }
+
+        graphData.numEdges = static_cast<int64_t>(graphData.edges.size());
+        return graphData;
+    }
+
+    /**
+     * Matrix Market coordinate matrices: entry (i, j) is an arc i -> j weighted by its value, real values are
+     * rounded, pattern matrices get weight 1. Symmetric matrices store only one triangle and become undirected.
+     */
+    static GraphData parseMatrixMarket(const char* data, const size_t size) {
+        LineCursor lines(data, data + size);
+        std::string_view line;
+        if (!lines.next(line)) throw std::runtime_error("Matrix Market file is empty");
+
+        std::string_view banner = line;
+        nextWord(banner);
+        const std::string_view object = nextWord(banner);
+        const std::string_view layout = nextWord(banner);
+        const std::string_view field = nextWord(banner);
+        const std::string_view symmetry = nextWord(banner);
+        if (object != "matrix" || layout != "coordinate") {
+            throw std::runtime_error("Only coordinate Matrix Market matrices describe graphs");
+        }
+        if (field != "real" && field != "integer" && field != "pattern") {
+            throw std::runtime_error("Unsupported Matrix Market field: " + std::string(field));
+        }
+        const bool pattern = field == "pattern";
+        const bool real = field == "real";
+
+        do {
+            if (!lines.next(line)) throw std::runtime_error("Matrix Market file has no size line");
+        } while (line.empty() || line[0] == '%');
+
+        IntegerScanner sizes = scannerOf(line, 0, data);
+        long long rows = 0;
+        long long columns = 0;
+        long long entries = 0;
+        if (!sizes.next(rows) || !sizes.next(columns) || !sizes.next(entries) || rows < 0 || columns < 0 || entries < 0
+            || std::max(rows, columns) > std::numeric_limits<int>::max()) {
+            throw malformedLine(data, line);
+        }
+
+        GraphData graphData;
+        graphData.numVertices = static_cast<int>(std::max(rows, columns));
+        graphData.isUndirected = symmetry != "general";
+        graphData.edges.reserve(static_cast<size_t>(entries));
+
+        while (lines.next(line)) {
+            if (line.empty() || line[0] == '%') continue;
+
+            IntegerScanner scanner = scannerOf(line, 0, data);
+            long long i = 0;
+            long long j = 0;
+            if (!scanner.next(i) || !scanner.next(j)) throw malformedLine(data, line);
+
+            int weight = 1;
+            if (!pattern) {
+                std::string_view rest(scanner.current(), static_cast<size_t>(line.data() + line.size() - scanner.current()));
+                weight = parseValue(nextWord(rest), real, data, line);
+            }
+            graphData.edges.add(vertexFromOne(i, graphData.numVertices, data, line),
+                                vertexFromOne(j, graphData.numVertices, data, line), weight);
+        }
+
+        if (graphData.edges.size() != static_cast<size_t>(entries)) {
+            throw std::runtime_error("Matrix Market file has " + std::to_string(graphData.edges.size()) + " of "
+                                     + std::to_string(entries) + " entries");
+        }
+        graphData.numEdges = static_cast<int64_t>(graphData.edges.size());
+        return graphData;
+    }
+
+    static int parseValue(const std::string_view text, const bool real, const char* origin, const std::string_view line) {
+        const char* end = text.data() + text.size();
+        double value = 0;
+        std::from_chars_result parsed {};
+        if (real) {
+            parsed = std::from_chars(text.data(), end, value);
+            value = std::round(value);
+        } else {
+            long long integer = 0;
+            parsed = std::from_chars(text.data(), end, integer);
+            value = static_cast<double>(integer);
+        }
+        if (text.empty() || parsed.ec != std::errc() || parsed.ptr != end) {
+            throw malformedLine(origin, line);
+        }
+
+        if (value < std::numeric_limits<int>::min() || value > std::numeric_limits<int>::max()) {
+            throw std::runtime_error("Weight does not fit into int at byte " + std::to_string(line.data() - origin));
+        }
+        return static_cast<int>(value);
+    }
+
+    /**
+     * SNAP edge lists: "u v" or "u v w" per line, '#' comment lines, "# Undirected graph" marks undirected files.
+     * Node ids are arbitrary non-negative numbers, so they are renumbered densely in increasing id order.
+     */
+    static GraphData parseSnap(const char* data, const size_t size) {
+        GraphData graphData;
+        LineCursor lines(data, data + size);
+        std::string_view line;
+
+        while (lines.next(line)) {
+            if (line.empty()) continue;
+            if (line[0] == '#') {
+                if (line.find("Undirected graph") != std::string_view::npos) {
+                    graphData.isUndirected = true;
+                }
+                continue;
+            }
+
+            IntegerScanner scanner = scannerOf(line, 0, data);
+            int u = 0;
+            int v = 0;
+            int weight = 1;
+            if (!scanner.next(u)) continue;
+            if (!scanner.next(v) || u < 0 || v < 0) throw malformedLine(data, line);
+            scanner.next(weight);
+            graphData.edges.add(u, v, weight);
+        }
+
+        // Sorted distinct ids, an id's position is its new number
+        DefinitelyNotAVector<int> ids;
+        ids.reserve(2 * graphData.edges.size());
+        for (size_t i = 0; i < graphData.edges.size(); i++) {
+            ids.push_back(graphData.edges.source(i));
+            ids.push_back(graphData.edges.destination(i));
+        }
+        std::sort(ids.begin(), ids.end());
+        int* distinctEnd = std::unique(ids.begin(), ids.end());
+        auto renumber = [&](const int id) {
+            return static_cast<int>(std::lower_bound(ids.begin(), distinctEnd, id) - ids.begin());
+        };
+
+        for (size_t i = 0; i < graphData.edges.size(); i++) {
+            graphData.edges.set(i, renumber(graphData.edges.source(i)), renumber(graphData.edges.destination(i)),
+                                graphData.edges.weight(i));
+        }
+
+        graphData.numVertices = static_cast<int>(distinctEnd - ids.begin());
+        graphData.numEdges = static_cast<int64_t>(graphData.edges.size());
+        return graphData;
+    }
+};
+
+#endif //GRAPHIMPORTER_H
@@ -0,0 +1,190 @@
+#ifndef GRAPHSINKS_H
+#define GRAPHSINKS_H
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "../Utils/Enums/MemoryPolicy.h"
+#include "../Utils/Parallel/ParallelFor.h"
+#include "../Utils/Representations/AdjacencyList.h"
+#include "../Utils/Representations/AdjancencyMatrix.h"
+#include "../Utils/Representations/CsrGraph.h"
+
+/**
+ * Builds a representation from a stream of edges, so a generator can write into it without a GraphData copy.
+ * Every edge arrives once per pass, an undirected one in only one direction, and never twice or as a self-loop.
+ * beginPass(pass, edgeCount) opens each of the PASSES passes with the number of edges that will follow.
+ * With CONCURRENT_ROWS addEdge may be called from several threads at once, for different source vertices.
+ */
+template<typename Sink>
+concept GraphSink = requires(Sink& sink, int vertex, int weight, size_t edgeCount) {
+    { Sink::DIRECTED } -> std::convertible_to<bool>;
+    { Sink::PASSES } -> std::convertible_to<int>;
+    { Sink::CONCURRENT_ROWS } -> std::convertible_to<bool>;
+    sink.beginPass(vertex, edgeCount);
+    sink.addEdge(vertex, vertex, weight);
+};
+
+// Arcs of a directed list only grow the list of their source; undirected edges also go to the other endpoint
+template<bool Directed, typename Weight = int>
+class AdjacencyListSink {
+private:
+    AdjacencyList<Directed, Weight> graph;
+    size_t edgeCount = 0;
+
+public:
+    static constexpr bool DIRECTED = Directed;
+    static constexpr int PASSES = 1;
+    static constexpr bool CONCURRENT_ROWS = Directed;
+
+    explicit AdjacencyListSink(const int vertices) : graph(vertices) {}
+
+    void beginPass(int, const size_t edges) { edgeCount = edges; }
+
+    void addEdge(const int source, const int destination, const int weight) {
+        if constexpr (Directed) {
+            graph.adjacencyList[source].push_back(WeightedEdge<Weight>(source, destination, static_cast<Weight>(weight)));
+        } else {
+            graph.addEdge(source, destination, static_cast<Weight>(weight));
+        }
+    }
+
+    AdjacencyList<Directed, Weight> build() {
+        graph.edgeCount = edgeCount;
+        return std::move(graph);
+    }
+};
+
+// Every edge owns its own cell, so rows are written concurrently and the edge count is set once at the end
+template<bool Directed, typename Weight = int>
+class AdjacencyMatrixSink {
+private:
+    AdjacencyMatrix<Directed, Weight> graph;
+    size_t edgeCount = 0;
+
+public:
+    static constexpr bool DIRECTED = Directed;
+    static constexpr int PASSES = 1;
+    static constexpr bool CONCURRENT_ROWS = true;
+
+    explicit AdjacencyMatrixSink(const int vertices, const MemoryPolicy memory = MemoryPolicy::STANDARD)
+        : graph(vertices, memory) {}
+
+    void beginPass(int, const size_t edges) { edgeCount = edges; }
+
+    void addEdge(const int source, const int destination, const int weight) {
+        graph.weights[graph.index(source, destination)] = static_cast<Weight>(weight);
+    }
+
+    AdjacencyMatrix<Directed, Weight> build() {
+        graph.edgeCount = edgeCount;
+        return std::move(graph);
+    }
+};
+
+/**
+ * CSR in two passes over the same edges: the first counts the degree of every vertex, the second places each arc
+ * at the next free slot of its row. Rows are filled concurrently, so build() sorts them by target at the end.
+ */
+template<bool Directed, typename Weight = int>
+class CsrSink {
+private:
+    struct Storage {
+        DefinitelyNotAVector<int64_t> offsets;
+        DefinitelyNotAVector<int32_t> targets;
+        DefinitelyNotAVector<Weight> weights;
+    };
+
+    int vertices;
+    int threads;
+    int pass = 0;
+    size_t edgeCount = 0;
+    std::shared_ptr<Storage> storage;
+    DefinitelyNotAVector<int64_t> cursors;
+
+    void place(const int source, const int destination, const int weight) {
+        const int64_t slot = std::atomic_ref<int64_t>(cursors[source]).fetch_add(1, std::memory_order_relaxed);
+        storage->targets[slot] = destination;
+        storage->weights[slot] = static_cast<Weight>(weight);
+    }
+
+    void sortRows() {
+        const auto& offsets = storage->offsets;
+        ParallelFor::run(vertices, threads, 1, [&](int, const size_t first, const size_t last) {
+            DefinitelyNotAVector<std::pair<int32_t, Weight>> row;
+            for (size_t u = first; u < last; u++) {
+                int32_t* targets = storage->targets.begin() + offsets[u];
+                Weight* weights = storage->weights.begin() + offsets[u];
+                const auto degree = static_cast<size_t>(offsets[u + 1] - offsets[u]);
+                if (std::is_sorted(targets, targets + degree)) continue;
+
+                row.clear();
+                for (size_t i = 0; i < degree; i++) {
+                    row.push_back({targets[i], weights[i]});
+                }
+                std::sort(row.begin(), row.end());
+                for (size_t i = 0; i < degree; i++) {
+                    targets[i] = row[i].first;
+                    weights[i] = row[i].second;
+                }
+            }
+        });
+    }
+
+public:
+    static constexpr bool DIRECTED = Directed;
+    static constexpr int PASSES = 2;
+    static constexpr bool CONCURRENT_ROWS = true;
+
+    explicit CsrSink(const int vertices, const int threads = ParallelFor::defaultThreadCount())
+        : vertices(vertices), threads(std::max(1, threads)), storage(std::make_shared<Storage>()) {}
+
+    void beginPass(const int number, const size_t edges) {
+        pass = number;
+        edgeCount = edges;
+        auto& offsets = storage->offsets;
+        if (pass == 0) {
+            offsets = DefinitelyNotAVector<int64_t>(static_cast<size_t>(vertices) + 1, 0);
+            return;
+        }
+
+        // Degrees were counted one slot ahead, so the prefix sums become the row starts
+        for (int u = 0; u < vertices; u++) {
+            offsets[u + 1] += offsets[u];
+        }
+        const auto arcs = static_cast<size_t>(offsets[vertices]);
+        storage->targets = DefinitelyNotAVector<int32_t>(arcs);
+        storage->weights = DefinitelyNotAVector<Weight>(arcs);
+        cursors = DefinitelyNotAVector<int64_t>(vertices);
+        std::copy_n(offsets.begin(), vertices, cursors.begin());
+    }
+
+    void addEdge(const int source, const int destination, const int weight) {
+        if (pass == 0) {
+            std::atomic_ref<int64_t>(storage->offsets[source + 1]).fetch_add(1, std::memory_order_relaxed);
+            if (!Directed && source != destination) {
+                std::atomic_ref<int64_t>(storage->offsets[destination + 1]).fetch_add(1, std::memory_order_relaxed);
+            }
+            return;
+        }
+
+        place(source, destination, weight);
+        if (!Directed && source != destination) {
+            place(destination, source, weight);
+        }
+    }
+
+    CsrGraph<Directed, Weight> build() {
+        sortRows();
+        cursors = DefinitelyNotAVector<int64_t>();
+        const Storage& built = *storage;
+        return CsrGraph<Directed, Weight>(vertices, edgeCount, built.offsets.begin(), built.targets.begin(),
+                                          built.weights.begin(), std::move(storage));
+    }
+};
+
+#endif //GRAPHSINKS_H
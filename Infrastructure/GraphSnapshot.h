@@ -0,0 +1,341 @@
+#ifndef GRAPHSNAPSHOT_H
+#define GRAPHSNAPSHOT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+#include "../Utils/GraphData.h"
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "../Utils/Representations/CsrGraph.h"
+#include "../Utils/Representations/WeightTraits.h"
+#include "MappedFile.h"
+
+/**
+ * Layout of a binary graph snapshot. The header is followed by the CSR arrays of the graph, each starting on a
+ * page boundary so the mapped file can be used in place:
+ *   offsets - int64_t[vertexCount + 1]
+ *   targets - int32_t[arcCount], every row sorted
+ *   weights - weightBytes-wide integers[arcCount]: uint8_t, uint16_t or int
+ * Files are written in host byte order, byteOrder tells a file from another host apart.
+ */
+struct GraphSnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t flags;
+    uint32_t weightBytes;
+    int64_t vertexCount;
+    int64_t edgeCount;   // each undirected edge counted once
+    int64_t arcCount;    // CSR entries, undirected edges appear in both rows
+    int32_t startVertex;
+    int32_t endVertex;
+    uint64_t offsetsPosition;
+    uint64_t targetsPosition;
+    uint64_t weightsPosition;
+};
+
+template<bool Directed>
+using CsrVariant = std::variant<CsrGraph<Directed, uint8_t>, CsrGraph<Directed, uint16_t>, CsrGraph<Directed, int>>;
+
+class GraphSnapshot {
+public:
+    static constexpr char MAGIC[8] = {'A', 'I', 'Z', 'O', 'C', 'S', 'R', '\0'};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+    static constexpr uint32_t DIRECTED_FLAG = 1;
+    static constexpr size_t ALIGNMENT = 4096;
+
+    [[nodiscard]] static bool isSnapshot(const char* data, const size_t size) {
+        return size >= sizeof(MAGIC) && std::memcmp(data, MAGIC, sizeof(MAGIC)) == 0;
+    }
+
+    /**
+     * Maps a snapshot and returns a graph whose arrays point straight into the mapped pages.
+     * Only the header is read, so opening takes the same time for any graph size; pages are loaded on first touch.
+     */
+    template<bool Directed, typename Weight = int>
+    static CsrGraph<Directed, Weight> open(const std::string& fileName) {
+        auto file = std::make_shared<const MappedFile>(fileName);
+        const char* data = file->data();
+        const GraphSnapshotHeader& header = readHeader(data, file->size(), fileName);
+        return view<Directed, Weight>(header, data, std::move(file), fileName);
+    }
+
+    // Opens a snapshot with whichever weight width it was written with
+    template<bool Directed>
+    static CsrVariant<Directed> openAny(const std::string& fileName) {
+        auto file = std::make_shared<const MappedFile>(fileName);
+        const char* data = file->data();
+        const GraphSnapshotHeader& header = readHeader(data, file->size(), fileName);
+        switch (header.weightBytes) {
+            case 1:
+                return view<Directed, uint8_t>(header, data, std::move(file), fileName);
+            case 2:
+                return view<Directed, uint16_t>(header, data, std::move(file), fileName);
+            default:
+                return view<Directed, int>(header, data, std::move(file), fileName);
+        }
+    }
+
+    // Unpacks a snapshot into edge form for the representations built from GraphData
+    static GraphData toGraphData(const char* data, const size_t size, const std::string& fileName) {
+        const GraphSnapshotHeader& header = readHeader(data, size, fileName);
+        switch (header.weightBytes) {
+            case 1:
+                return toGraphData<uint8_t>(header, data);
+            case 2:
+                return toGraphData<uint16_t>(header, data);
+            default:
+                return toGraphData<int>(header, data);
+        }
+    }
+
+    /**
+     * data with its edges in the order toGraphData reads them back from a snapshot of it: by source, then target,
+     * undirected edges from their smaller endpoint, parallel edges in their original order.
+     * Graphs kept next to their snapshots use this order, so a graph is the same whether it was stored or loaded.
+     */
+    static GraphData canonicalOrder(const GraphData& data) {
+        auto endpoints = [&](const size_t i) {
+            const int source = data.edges.source(i);
+            const int destination = data.edges.destination(i);
+            return data.isUndirected && destination < source ? std::pair{destination, source} : std::pair{source, destination};
+        };
+
+        DefinitelyNotAVector<size_t> order(data.edges.size());
+        for (size_t i = 0; i < order.size(); i++) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](const size_t a, const size_t b) {
+            return endpoints(a) < endpoints(b);
+        });
+
+        GraphData canonical;
+        canonical.numVertices = data.numVertices;
+        canonical.startVertex = data.startVertex;
+        canonical.endVertex = data.endVertex;
+        canonical.isUndirected = data.isUndirected;
+        canonical.edges.reserve(order.size());
+        for (const size_t i : order) {
+            const auto [source, destination] = endpoints(i);
+            canonical.edges.add(source, destination, data.edges.weight(i));
+        }
+        canonical.numEdges = static_cast<int64_t>(canonical.edges.size());
+        return canonical;
+    }
+
+    // Writes data with the narrowest weight width that holds all of its weights
+    template<typename DataWeight>
+    static void write(const std::string& fileName, const WeightedGraphData<DataWeight>& data) {
+        long long minWeight = 0;
+        long long maxWeight = 0;
+        for (size_t i = 0; i < data.edges.size(); i++) {
+            const auto weight = static_cast<long long>(data.edges.weight(i));
+            if (i == 0 || weight < minWeight) minWeight = weight;
+            if (i == 0 || weight > maxWeight) maxWeight = weight;
+        }
+
+        if (WeightTraits<uint8_t>::fits(minWeight, maxWeight)) {
+            writeWithWeight<uint8_t>(fileName, data);
+        } else if (WeightTraits<uint16_t>::fits(minWeight, maxWeight)) {
+            writeWithWeight<uint16_t>(fileName, data);
+        } else if (WeightTraits<int>::fits(minWeight, maxWeight)) {
+            writeWithWeight<int>(fileName, data);
+        } else {
+            throw std::invalid_argument("Edge weights do not fit into a snapshot");
+        }
+    }
+
+    template<typename Weight, typename DataWeight>
+    static void writeWithWeight(const std::string& fileName, const WeightedGraphData<DataWeight>& data) {
+        const int V = data.numVertices;
+        const bool mirror = data.isUndirected;
+
+        // Counting sort by source - row sizes first, then every arc into its row
+        DefinitelyNotAVector<int64_t> offsets(static_cast<size_t>(V) + 1, 0);
+        for (size_t i = 0; i < data.edges.size(); i++) {
+            const int source = data.edges.source(i);
+            const int destination = data.edges.destination(i);
+            if (source < 0 || source >= V || destination < 0 || destination >= V) {
+                throw std::invalid_argument("Invalid vertex number detected");
+            }
+            offsets[source + 1]++;
+            if (mirror && source != destination) offsets[destination + 1]++;
+        }
+        for (int v = 0; v < V; v++) {
+            offsets[v + 1] += offsets[v];
+        }
+
+        const auto arcCount = static_cast<size_t>(offsets[V]);
+        DefinitelyNotAVector<Arc<Weight>> arcs(arcCount);
+        DefinitelyNotAVector<int64_t> cursor(offsets);
+        for (size_t i = 0; i < data.edges.size(); i++) {
+            const int source = data.edges.source(i);
+            const int destination = data.edges.destination(i);
+            const auto weight = static_cast<Weight>(data.edges.weight(i));
+            arcs[cursor[source]++] = Arc<Weight>{destination, weight};
+            if (mirror && source != destination) arcs[cursor[destination]++] = Arc<Weight>{source, weight};
+        }
+
+        // Sorted rows let getWeight binary search; stable, so parallel edges keep their file order
+        for (int v = 0; v < V; v++) {
+            std::stable_sort(arcs.begin() + offsets[v], arcs.begin() + offsets[v + 1],
+                             [](const Arc<Weight>& a, const Arc<Weight>& b) { return a.target < b.target; });
+        }
+
+        GraphSnapshotHeader header {};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.byteOrder = BYTE_ORDER_MARK;
+        header.flags = mirror ? 0 : DIRECTED_FLAG;
+        header.weightBytes = sizeof(Weight);
+        header.vertexCount = V;
+        header.edgeCount = static_cast<int64_t>(data.edges.size());
+        header.arcCount = static_cast<int64_t>(arcCount);
+        header.startVertex = data.startVertex;
+        header.endVertex = data.endVertex;
+        header.offsetsPosition = ALIGNMENT;
+        header.targetsPosition = pageAligned(header.offsetsPosition + (V + 1) * sizeof(int64_t));
+        header.weightsPosition = pageAligned(header.targetsPosition + arcCount * sizeof(int32_t));
+
+        std::ofstream out(fileName, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            throw std::runtime_error("Could not create file: " + fileName);
+        }
+
+        writeBytes(out, &header, sizeof(header));
+        padTo(out, header.offsetsPosition);
+        writeBytes(out, offsets.data(), offsets.size() * sizeof(int64_t));
+        padTo(out, header.targetsPosition);
+        writeColumn<int32_t>(out, arcs, [](const Arc<Weight>& arc) { return arc.target; });
+        padTo(out, header.weightsPosition);
+        writeColumn<Weight>(out, arcs, [](const Arc<Weight>& arc) { return arc.weight; });
+
+        if (!out) {
+            throw std::runtime_error("Could not write file: " + fileName);
+        }
+    }
+
+private:
+    template<typename Weight>
+    struct Arc {
+        int32_t target;
+        Weight weight;
+    };
+
+    static uint64_t pageAligned(const uint64_t position) {
+        return (position + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+    static void writeBytes(std::ofstream& out, const void* bytes, const size_t count) {
+        out.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(count));
+    }
+
+    static void padTo(std::ofstream& out, const uint64_t position) {
+        static constexpr char zeros[ALIGNMENT] = {};
+        const auto current = static_cast<uint64_t>(out.tellp());
+        writeBytes(out, zeros, position - current);
+    }
+
+    // Splits one field of the arcs out through a fixed buffer instead of a second full-size array
+    template<typename Field, typename Weight, typename Select>
+    static void writeColumn(std::ofstream& out, const DefinitelyNotAVector<Arc<Weight>>& arcs, Select select) {
+        constexpr size_t BUFFER_FIELDS = size_t(64) << 10;
+        DefinitelyNotAVector<Field> buffer(std::min(arcs.size(), BUFFER_FIELDS));
+        for (size_t first = 0; first < arcs.size(); first += BUFFER_FIELDS) {
+            const size_t count = std::min(BUFFER_FIELDS, arcs.size() - first);
+            for (size_t i = 0; i < count; i++) {
+                buffer[i] = select(arcs[first + i]);
+            }
+            writeBytes(out, buffer.data(), count * sizeof(Field));
+        }
+    }
+
+    // Checks everything that can be checked without touching the arrays themselves
+    static const GraphSnapshotHeader& readHeader(const char* data, const size_t size, const std::string& fileName) {
+        if (!isSnapshot(data, size) || size < sizeof(GraphSnapshotHeader)) {
+            throw std::runtime_error("Not a graph snapshot: " + fileName);
+        }
+
+        const auto& header = *reinterpret_cast<const GraphSnapshotHeader*>(data);
+        if (header.byteOrder != BYTE_ORDER_MARK) {
+            throw std::runtime_error("Snapshot was written with a different byte order: " + fileName);
+        }
+        if (header.version != VERSION) {
+            throw std::runtime_error("Unsupported snapshot version " + std::to_string(header.version) + ": " + fileName);
+        }
+        if (header.weightBytes != 1 && header.weightBytes != 2 && header.weightBytes != 4) {
+            throw std::runtime_error("Unsupported snapshot weight width: " + fileName);
+        }
+        if (header.vertexCount < 0 || header.vertexCount > INT32_MAX || header.arcCount < 0 || header.edgeCount < 0) {
+            throw std::runtime_error("Invalid snapshot dimensions: " + fileName);
+        }
+
+        const auto arcs = static_cast<uint64_t>(header.arcCount);
+        const bool aligned = header.offsetsPosition % ALIGNMENT == 0 && header.targetsPosition % ALIGNMENT == 0
+                             && header.weightsPosition % ALIGNMENT == 0;
+        const bool inside = header.offsetsPosition + (header.vertexCount + 1) * sizeof(int64_t) <= size
+                            && header.targetsPosition + arcs * sizeof(int32_t) <= size
+                            && header.weightsPosition + arcs * header.weightBytes <= size;
+        if (!aligned || !inside) {
+            throw std::runtime_error("Snapshot is truncated or corrupt: " + fileName);
+        }
+        return header;
+    }
+
+    template<bool Directed, typename Weight>
+    static CsrGraph<Directed, Weight> view(const GraphSnapshotHeader& header, const char* data,
+                                           std::shared_ptr<const MappedFile> file, const std::string& fileName) {
+        if (((header.flags & DIRECTED_FLAG) != 0) != Directed) {
+            throw std::invalid_argument(std::string("Snapshot holds ") + (Directed ? "an undirected" : "a directed")
+                                        + " graph: " + fileName);
+        }
+        if (header.weightBytes != sizeof(Weight)) {
+            throw std::invalid_argument("Snapshot stores " + std::to_string(header.weightBytes) + "-byte weights: " + fileName);
+        }
+
+        return CsrGraph<Directed, Weight>(
+            static_cast<int>(header.vertexCount), static_cast<size_t>(header.edgeCount),
+            reinterpret_cast<const int64_t*>(data + header.offsetsPosition),
+            reinterpret_cast<const int32_t*>(data + header.targetsPosition),
+            reinterpret_cast<const Weight*>(data + header.weightsPosition),
+            std::move(file));
+    }
+
+    template<typename Weight>
+    static GraphData toGraphData(const GraphSnapshotHeader& header, const char* data) {
+        const auto* offsets = reinterpret_cast<const int64_t*>(data + header.offsetsPosition);
+        const auto* targets = reinterpret_cast<const int32_t*>(data + header.targetsPosition);
+        const auto* weights = reinterpret_cast<const Weight*>(data + header.weightsPosition);
+        const bool undirected = (header.flags & DIRECTED_FLAG) == 0;
+
+        GraphData graphData;
+        graphData.numVertices = static_cast<int>(header.vertexCount);
+        graphData.startVertex = header.startVertex;
+        graphData.endVertex = header.endVertex;
+        graphData.isUndirected = undirected;
+        graphData.edges.reserve(static_cast<size_t>(header.edgeCount));
+
+        // Every array is read here anyway, so the row bounds are checked before they are followed
+        if (offsets[0] != 0 || offsets[graphData.numVertices] != header.arcCount
+            || !std::is_sorted(offsets, offsets + graphData.numVertices + 1)) {
+            throw std::runtime_error("Snapshot has corrupt row offsets");
+        }
+
+        for (int u = 0; u < graphData.numVertices; u++) {
+            for (int64_t arc = offsets[u]; arc < offsets[u + 1]; arc++) {
+                if (!undirected || u <= targets[arc]) {
+                    graphData.edges.add(u, targets[arc], static_cast<int>(weights[arc]));
+                }
+            }
+        }
+        graphData.numEdges = static_cast<int64_t>(graphData.edges.size());
+        return graphData;
+    }
+};
+
+#endif //GRAPHSNAPSHOT_H
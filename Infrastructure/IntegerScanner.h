@@ -0,0 +1,47 @@
+#ifndef INTEGERSCANNER_H
+#define INTEGERSCANNER_H
+
+#include <charconv>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+// Whitespace-separated integers straight from a character range, parsed with std::from_chars
+class IntegerScanner {
+private:
+    const char* first;
+    const char* position;
+    const char* last;
+
+    static bool isSpace(const char c) {
+        return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+    }
+
+public:
+    // Error positions are counted from origin - the start of the whole file when scanning a chunk of it
+    IntegerScanner(const char* begin, const char* end, const char* origin = nullptr)
+        : first(origin != nullptr ? origin : begin), position(begin), last(end) {}
+
+    // False at the end of the range, throws on anything that is not an integer
+    template<typename Integer>
+    bool next(Integer& value) {
+        while (position < last && isSpace(*position)) {
+            ++position;
+        }
+        if (position == last) {
+            return false;
+        }
+
+        const auto [end, error] = std::from_chars(position, last, value);
+        if (error != std::errc() || (end < last && !isSpace(*end))) {
+            throw std::runtime_error("Malformed number at byte " + std::to_string(position - first));
+        }
+        position = end;
+        return true;
+    }
+
+    [[nodiscard]] const char* current() const { return position; }
+    [[nodiscard]] size_t remaining() const { return static_cast<size_t>(last - position); }
+};
+
+#endif //INTEGERSCANNER_H
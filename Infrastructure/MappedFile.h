@@ -0,0 +1,81 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAPPED_FILE_HAS_MMAP 1
+#else
+#include <fstream>
+#include <iterator>
+#endif
+
+// Read-only view of a whole file - memory-mapped where mmap exists, read into memory elsewhere
+class MappedFile {
+private:
+    const char* begin;
+    size_t length;
+#ifdef MAPPED_FILE_HAS_MMAP
+    void* mapping;
+#else
+    std::string contents;
+#endif
+
+public:
+    explicit MappedFile(const std::string& path) : begin(nullptr), length(0) {
+#ifdef MAPPED_FILE_HAS_MMAP
+        mapping = nullptr;
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            throw std::runtime_error("Could not open file: " + path);
+        }
+
+        struct stat info {};
+        if (fstat(fd, &info) == -1) {
+            close(fd);
+            throw std::runtime_error("Could not read size of file: " + path);
+        }
+        length = static_cast<size_t>(info.st_size);
+
+        // An empty file cannot be mapped, it simply has no data
+        if (length > 0) {
+            mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED) {
+                close(fd);
+                throw std::runtime_error("Could not map file: " + path);
+            }
+            madvise(mapping, length, MADV_SEQUENTIAL);
+            begin = static_cast<const char*>(mapping);
+        }
+        close(fd);
+#else
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Could not open file: " + path);
+        }
+        contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        begin = contents.data();
+        length = contents.size();
+#endif
+    }
+
+    ~MappedFile() {
+#ifdef MAPPED_FILE_HAS_MMAP
+        if (mapping != nullptr) munmap(mapping, length);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    [[nodiscard]] const char* data() const { return begin; }
+    [[nodiscard]] size_t size() const { return length; }
+};
+
+#endif //MAPPEDFILE_H
@@ -2,19 +2,213 @@
 #define RANDOMGRAPHGENERATOR_H
 #include "../Utils/GraphData.h"
 #include "../Utils/DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "../Utils/DefinitelyNotADataStructures/DefinitelyNotABitset.h"
+#include "../Utils/Parallel/ParallelFor.h"
+#include "../Utils/Random/CounterRandom.h"
+#include "../Utils/Enums/GraphRepresentationType.h"
+#include "../Utils/Representations/GraphVariant.h"
+#include "../Utils/Enums/GraphFamily.h"
+#include "GraphFamilyGenerator.h"
+#include "GraphSinks.h"
 #include <random>
 #include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
 
+/**
+ * Connected random graphs of a given density, fully determined by the seed.
+ * A shuffled spanning path (undirected) or Hamiltonian cycle (directed) keeps the graph connected, the remaining edges
+ * are uniform over the free slots of the rows - arcs leaving a vertex, or undirected edges to larger vertices.
+ * How many of them land in each row is drawn from the seed by halving the rows and splitting the edges
+ * hypergeometrically, as if they had been drawn from all free slots at once. Every row then picks its edges from its
+ * own CounterRandom stream, so rows are generated in parallel and the graph is bit-identical for any thread count.
+ */
 class RandomGraphGenerator {
 private:
-    std::random_device rd;
-    std::mt19937 gen;
-    
+    uint64_t seed;
+    int threads;
+
+    // Stream 0 shuffles the backbone, row u draws from stream u + 1, the last stream splits the edges over the rows
+    static constexpr uint64_t BACKBONE_STREAM = 0;
+    static constexpr uint64_t SPLIT_STREAM = UINT64_MAX;
+    // Blocks of rows per thread, so threads with cheap rows take over more blocks
+    static constexpr int BLOCKS_PER_THREAD = 4;
+
 public:
-    RandomGraphGenerator() : gen(rd()) {}
+    // Bumped whenever the same seed starts producing different graphs, so stored graphs of older versions are not reused
+    static constexpr int VERSION = 3;
+
+    static constexpr int DEFAULT_MIN_WEIGHT = 1;
+    static constexpr int DEFAULT_MAX_WEIGHT = 100;
+
+    // A fresh seed from std::random_device - getSeed() tells it, so the graph can still be reproduced
+    RandomGraphGenerator() : RandomGraphGenerator(randomSeed()) {}
+
+    // Same seed and generate() arguments, same graph
+    explicit RandomGraphGenerator(const uint64_t seed, const int threads = ParallelFor::defaultThreadCount())
+        : seed(seed), threads(std::max(1, threads)) {}
+
+    [[nodiscard]] uint64_t getSeed() const { return seed; }
+
+    GraphData generate(const int vertices, const int density, const bool isDirected,
+                       const int minWeight = DEFAULT_MIN_WEIGHT, const int maxWeight = DEFAULT_MAX_WEIGHT) {
+        const Plan plan = makePlan(vertices, density, isDirected, minWeight, maxWeight);
+
+        GraphData graph;
+        graph.numVertices = vertices;
+        graph.isUndirected = !isDirected;
+        graph.edges.resize(plan.edgeCount());
+        emitEdges(plan, true, [&](const size_t index, const int source, const int destination, const int weight) {
+            graph.edges.set(index, source, destination, weight);
+        });
+
+        graph.numEdges = static_cast<int64_t>(graph.edges.size());
+        return graph;
+    }
+
+    // A graph of the given family - density sets the edge count the family aims for, see GraphFamilyGenerator
+    GraphData generate(const GraphFamily family, const int vertices, const int density, const bool isDirected,
+                       const int minWeight = DEFAULT_MIN_WEIGHT, const int maxWeight = DEFAULT_MAX_WEIGHT) {
+        if (family == GraphFamily::UNIFORM) {
+            return generate(vertices, density, isDirected, minWeight, maxWeight);
+        }
+
+        validate(vertices, density, minWeight, maxWeight);
+        const GraphFamilyGenerator generator(seed, threads);
+        return generator.generate(family, vertices, edgeCount(vertices, density, isDirected), isDirected, minWeight, maxWeight);
+    }
+
+    static std::string familyName(const GraphFamily family) {
+        switch (family) {
+            case GraphFamily::UNIFORM: return "UNIFORM";
+            case GraphFamily::RMAT: return "RMAT";
+            case GraphFamily::GRID_2D: return "GRID_2D";
+            case GraphFamily::GRID_3D: return "GRID_3D";
+            case GraphFamily::POWER_LAW: return "POWER_LAW";
+            case GraphFamily::GEOMETRIC: return "GEOMETRIC";
+        }
+        return "UNKNOWN";
+    }
+
+    /**
+     * The same graph as generate(), written straight into a representation builder - only the representation is
+     * ever held in memory. Directedness comes from the sink.
+     */
+    template<GraphSink Sink>
+    void generateInto(Sink& sink, const int vertices, const int density,
+                      const int minWeight = DEFAULT_MIN_WEIGHT, const int maxWeight = DEFAULT_MAX_WEIGHT) {
+        const Plan plan = makePlan(vertices, density, Sink::DIRECTED, minWeight, maxWeight);
+
+        for (int pass = 0; pass < Sink::PASSES; pass++) {
+            sink.beginPass(pass, plan.edgeCount());
+            emitEdges(plan, Sink::CONCURRENT_ROWS, [&](size_t, const int source, const int destination, const int weight) {
+                sink.addEdge(source, destination, weight);
+            });
+        }
+    }
+
+    template<bool Directed, typename Weight = int>
+    AdjacencyList<Directed, Weight> generateAdjacencyList(const int vertices, const int density,
+                                                          const int minWeight = DEFAULT_MIN_WEIGHT,
+                                                          const int maxWeight = DEFAULT_MAX_WEIGHT) {
+        AdjacencyListSink<Directed, Weight> sink(vertices);
+        generateInto(sink, vertices, density, minWeight, maxWeight);
+        return sink.build();
+    }
+
+    template<bool Directed, typename Weight = int>
+    AdjacencyMatrix<Directed, Weight> generateAdjacencyMatrix(const int vertices, const int density,
+                                                              const MemoryPolicy memory = MemoryPolicy::STANDARD,
+                                                              const int minWeight = DEFAULT_MIN_WEIGHT,
+                                                              const int maxWeight = DEFAULT_MAX_WEIGHT) {
+        AdjacencyMatrixSink<Directed, Weight> sink(vertices, memory);
+        generateInto(sink, vertices, density, minWeight, maxWeight);
+        return sink.build();
+    }
+
+    // Like GraphConverter::ConvertToRepresenstation, weights get the narrowest type that holds [minWeight, maxWeight]
+    template<bool Directed>
+    GraphVariant<Directed> generateRepresentation(const int vertices, const int density, const GraphRepresentationType type,
+                                                  const int minWeight = DEFAULT_MIN_WEIGHT,
+                                                  const int maxWeight = DEFAULT_MAX_WEIGHT) {
+        if (WeightTraits<uint8_t>::fits(minWeight, maxWeight)) {
+            return generateWithWeight<Directed, uint8_t>(vertices, density, type, minWeight, maxWeight);
+        }
+        if (WeightTraits<uint16_t>::fits(minWeight, maxWeight)) {
+            return generateWithWeight<Directed, uint16_t>(vertices, density, type, minWeight, maxWeight);
+        }
+        return generateWithWeight<Directed, int>(vertices, density, type, minWeight, maxWeight);
+    }
+
+    // Edge count generate() produces for these arguments, known without generating anything
+    static int64_t edgeCount(const int vertices, const int density, const bool isDirected) {
+        const int64_t maxPossibleEdges = maxEdges(vertices, isDirected);
+        const int64_t backboneEdges = isDirected ? (vertices > 1 ? vertices : 0) : vertices - 1;
+        const int64_t targetEdges = density >= 99 ? maxPossibleEdges : maxPossibleEdges * density / 100;
+        return std::min(std::max(targetEdges, backboneEdges), maxPossibleEdges);
+    }
+
+private:
+    struct BackboneEdge {
+        int source;
+        int destination;
+        int weight;
+    };
+
+    // Backbone edges and, per row, the columns they occupy (at most two per row)
+    struct Backbone {
+        DefinitelyNotAVector<BackboneEdge> edges;
+        DefinitelyNotAVector<int> count;
+        DefinitelyNotAVector<int> columns;
+
+        explicit Backbone(const int vertices) : count(vertices), columns(2 * static_cast<size_t>(vertices)) {}
+
+        void add(const int source, const int destination, const int weight, const bool isDirected) {
+            edges.push_back(BackboneEdge{source, destination, weight});
+            const int row = isDirected ? source : std::min(source, destination);
+            const int column = isDirected ? destination : std::max(source, destination);
+            columns[2 * static_cast<size_t>(row) + count[row]++] = column;
+        }
+    };
+
+    // Per-thread marks of the columns taken in the current row
+    struct RowScratch {
+        DefinitelyNotABitset taken;
+        DefinitelyNotAVector<int> picked;
+
+        explicit RowScratch(const int vertices) : taken(vertices) {}
+    };
+
+    // Backbone and per-row edge ranges - everything about the graph except the edges the rows draw
+    struct Plan {
+        int vertices;
+        bool isDirected;
+        int minWeight;
+        int maxWeight;
+        Backbone backbone;
+        DefinitelyNotAVector<int64_t> rowOffsets;
+
+        Plan(const int vertices, const bool isDirected, const int minWeight, const int maxWeight)
+            : vertices(vertices), isDirected(isDirected), minWeight(minWeight), maxWeight(maxWeight),
+              backbone(vertices), rowOffsets(static_cast<size_t>(vertices) + 1, 0) {}
+
+        [[nodiscard]] size_t edgeCount() const { return static_cast<size_t>(rowOffsets[vertices]); }
+    };
+
+    static uint64_t randomSeed() {
+        std::random_device rd;
+        return (static_cast<uint64_t>(rd()) << 32) ^ rd();
+    }
 
-    GraphData generate(const int vertices, const int density, const bool isDirected, const int minWeight = 1, const int maxWeight = 100) {
-        // Validate inputs
+    // In 64 bits, V * (V - 1) overflows int above ~46k vertices
+    static int64_t maxEdges(const int vertices, const bool isDirected) {
+        return isDirected
+            ? static_cast<int64_t>(vertices) * (vertices - 1)
+            : static_cast<int64_t>(vertices) * (vertices - 1) / 2;
+    }
+
+    static void validate(const int vertices, const int density, const int minWeight, const int maxWeight) {
         if (vertices <= 0) {
             throw std::invalid_argument("Number of vertices must be positive");
         }
@@ -23,130 +217,224 @@ public:
             throw std::invalid_argument("Density must be between 0 and 100");
         }
 
-        try {
-            if (density >= 99) { // Handle high density cases with the complete graph generator
-                return generateComplete(vertices, isDirected, minWeight, maxWeight);
-            }
+        if (minWeight > maxWeight) {
+            throw std::invalid_argument("Minimum weight must not exceed maximum weight");
+        }
+    }
 
-            GraphData graph;
-            graph.numVertices = vertices;
+    [[nodiscard]] Plan makePlan(const int vertices, const int density, const bool isDirected,
+                                const int minWeight, const int maxWeight) const {
+        validate(vertices, density, minWeight, maxWeight);
 
-            if (isDirected) {
-                generateDirectedConnected(graph, minWeight, maxWeight);
-            } else {
-                generateUndirectedConnected(graph, minWeight, maxWeight);
-            }
+        // High densities give the complete graph
+        const int64_t maxPossibleEdges = maxEdges(vertices, isDirected);
+        const int64_t targetEdges = density >= 99 ? maxPossibleEdges : maxPossibleEdges * density / 100;
 
-            // Calculate remaining edges to add based on density
-            int maxPossibleEdges;
-            if (isDirected) {
-                maxPossibleEdges = vertices * (vertices - 1);
-            } else {
-                maxPossibleEdges = (vertices * (vertices - 1)) / 2;
-            }
+        Plan plan(vertices, isDirected, minWeight, maxWeight);
+        Backbone& backbone = plan.backbone;
+        buildBackbone(backbone, isDirected, minWeight, maxWeight);
 
-            int existingEdges = isDirected ? graph.edges.size() : graph.edges.size() / 2;
+        // Free slots of a row: its candidate columns minus its backbone edges
+        auto candidates = [&](const int u) -> int64_t {
+            return isDirected ? vertices - 1 : vertices - 1 - u;
+        };
 
-            int targetEdges = (maxPossibleEdges * density) / 100;
-            int remainingEdges = targetEdges - existingEdges;
+        const auto backboneEdges = static_cast<int64_t>(backbone.edges.size());
+        int64_t freeSlots = 0;
+        for (int u = 0; u < vertices; u++) {
+            freeSlots += candidates(u) - backbone.count[u];
+        }
+        const int64_t remainingEdges = std::clamp<int64_t>(targetEdges - backboneEdges, 0, freeSlots);
 
-            if (remainingEdges > 0) {
-                addRandomEdges(graph, remainingEdges, isDirected, minWeight, maxWeight);
-            }
+        DefinitelyNotAVector<int64_t> slotsBefore(static_cast<size_t>(vertices) + 1, 0);
+        for (int u = 0; u < vertices; u++) {
+            slotsBefore[u + 1] = slotsBefore[u] + candidates(u) - backbone.count[u];
+        }
+
+        // Row quotas go one slot ahead, so the prefix sums become the row starts
+        auto& rowOffsets = plan.rowOffsets;
+        CounterRandom random(seed, SPLIT_STREAM);
+        splitEdges(0, vertices, remainingEdges, slotsBefore, rowOffsets, random);
+        rowOffsets[0] = backboneEdges;
+        for (int u = 0; u < vertices; u++) {
+            rowOffsets[u + 1] += rowOffsets[u];
+        }
+        return plan;
+    }
 
-            return graph;
-        } catch (const std::exception& e) {
-            std::cerr << "Error in generate: " << e.what() << std::endl;
-            throw; // Re-throw to be handled by caller
+    // Splits edges over rows [first, last): the first half gets as many as a uniform draw from the free slots of all
+    // of them would put there, and both halves are split the same way until single rows are left
+    static void splitEdges(const int first, const int last, const int64_t edges,
+                           const DefinitelyNotAVector<int64_t>& slotsBefore, DefinitelyNotAVector<int64_t>& quotas,
+                           CounterRandom& random) {
+        if (edges == 0) return;
+        if (last - first == 1) {
+            quotas[first + 1] = edges;
+            return;
         }
+
+        const int middle = first + (last - first) / 2;
+        const int64_t firstHalf = random.hypergeometric(slotsBefore[last] - slotsBefore[first],
+                                                        slotsBefore[middle] - slotsBefore[first], edges);
+        splitEdges(first, middle, firstHalf, slotsBefore, quotas, random);
+        splitEdges(middle, last, edges - firstHalf, slotsBefore, quotas, random);
     }
 
+    /**
+     * Hands every edge of the plan to emit(index, source, destination, weight) - the backbone first, then the rows.
+     * Concurrent rows run in parallel blocks, otherwise rows are emitted one after another in increasing order.
+     */
+    template<typename Emit>
+    void emitEdges(const Plan& plan, const bool concurrentRows, Emit&& emit) const {
+        const auto& backbone = plan.backbone;
+        for (size_t i = 0; i < backbone.edges.size(); i++) {
+            const BackboneEdge& edge = backbone.edges[i];
+            emit(i, edge.source, edge.destination, edge.weight);
+        }
 
-private:
-    void generateUndirectedConnected(GraphData& graph, int minWeight, int maxWeight) {
-        // Generate spanning tree first
-        DefinitelyNotAVector<int> vertices(graph.numVertices);
-        for (int i = 0; i < graph.numVertices; i++) vertices[i] = i;
-        std::ranges::shuffle(vertices, gen);
-
-        // Add edges to form a spanning tree
-        for (int i = 1; i < graph.numVertices; i++) {
-            int from = vertices[i-1];
-            int to = vertices[i];
-            int weight = std::uniform_int_distribution<>(minWeight, maxWeight)(gen);
-            graph.edges.emplace_back(from, to, weight);
-        }
-    }
-
-    void generateDirectedConnected(GraphData& graph, int minWeight, int maxWeight) {
-        // Generate a Hamiltonian cycle first
-        DefinitelyNotAVector<int> vertices(graph.numVertices);
-        for (int i = 0; i < graph.numVertices; i++) vertices[i] = i;
-        std::ranges::shuffle(vertices, gen);
-
-        // Create cycle
-        for (int i = 0; i < graph.numVertices; i++) {
-            int from = vertices[i];
-            int to = vertices[(i + 1) % graph.numVertices];
-            int weight = std::uniform_int_distribution<>(minWeight, maxWeight)(gen);
-            graph.edges.emplace_back(from, to, weight);
-        }
-    }
-
-    GraphData generateComplete(int vertices, bool isDirected, int minWeight, int maxWeight)
-    {
-        GraphData complete;
-        complete.numVertices = vertices;
-
-        try {
-            // For undirected graphs, add edges only once (i,j) to prevent duplicates
-            for (int i = 0; i < vertices; i++) {
-                for (int j = 0; j < vertices; j++) {
-                    if (i != j) { // Skip self-loops
-                        int weight = std::uniform_int_distribution<>(minWeight, maxWeight)(gen);
-                        if (isDirected || i < j) { // For undirected graphs, only add edges where i < j
-                            complete.edges.emplace_back(i, j, weight);
-                        }
-                    }
-                }
+        const auto& rowOffsets = plan.rowOffsets;
+        auto generateRows = [&](const int firstRow, const int lastRow) {
+            RowScratch scratch(plan.vertices);
+            for (int u = firstRow; u < lastRow; u++) {
+                generateRow(plan, u, rowOffsets[u], rowOffsets[u + 1] - rowOffsets[u], scratch, emit);
             }
+        };
 
-            return complete;
+        if (!concurrentRows) {
+            generateRows(0, plan.vertices);
+            return;
         }
-        catch (const std::exception& e) {
-            std::cerr << "Error in generateComplete: " << e.what() << std::endl;
-            throw; // Re-throw to be handled by caller
+
+        const auto blocks = balancedBlocks(plan.vertices, plan.isDirected);
+        ParallelFor::run(blocks.size() - 1, threads, 1, [&](int, const size_t firstBlock, const size_t lastBlock) {
+            generateRows(blocks[firstBlock], blocks[lastBlock]);
+        });
+    }
+
+    template<bool Directed, typename Weight>
+    GraphVariant<Directed> generateWithWeight(const int vertices, const int density, const GraphRepresentationType type,
+                                              const int minWeight, const int maxWeight) {
+        switch (type) {
+            case GraphRepresentationType::ADJACENCY_LIST:
+                return generateAdjacencyList<Directed, Weight>(vertices, density, minWeight, maxWeight);
+            case GraphRepresentationType::ADJACENCY_MATRIX:
+                return generateAdjacencyMatrix<Directed, Weight>(vertices, density, MemoryPolicy::STANDARD, minWeight, maxWeight);
         }
+        throw std::invalid_argument("Unknown graph representation");
     }
 
+    void buildBackbone(Backbone& backbone, const bool isDirected, const int minWeight, const int maxWeight) const {
+        const int vertices = static_cast<int>(backbone.count.size());
+        CounterRandom random(seed, BACKBONE_STREAM);
 
-    void addRandomEdges(GraphData& graph, int count, bool isDirected, int minWeight, int maxWeight) {
-        std::uniform_int_distribution<> vertexDist(0, graph.numVertices - 1);
-        std::uniform_int_distribution<> weightDist(minWeight, maxWeight);
+        // Fisher-Yates shuffle of the vertex order
+        DefinitelyNotAVector<int> order(vertices);
+        for (int i = 0; i < vertices; i++) order[i] = i;
+        for (int i = vertices - 1; i > 0; i--) {
+            std::swap(order[i], order[random.below(static_cast<uint32_t>(i) + 1)]);
+        }
 
-        while (count > 0) {
-            int from = vertexDist(gen);
-            int to = vertexDist(gen);
+        if (isDirected) {
+            // Hamiltonian cycle - every vertex reaches every other one
+            backbone.edges.reserve(vertices);
+            for (int i = 0; vertices > 1 && i < vertices; i++) {
+                backbone.add(order[i], order[(i + 1) % vertices], random.between(minWeight, maxWeight), true);
+            }
+        } else {
+            // Spanning path
+            backbone.edges.reserve(vertices);
+            for (int i = 1; i < vertices; i++) {
+                backbone.add(order[i - 1], order[i], random.between(minWeight, maxWeight), false);
+            }
+        }
+    }
 
-            if (from != to && !edgeExists(graph, from, to)) {
-                int weight = weightDist(gen);
-                graph.edges.emplace_back(from, to, weight);
-                if (!isDirected) {
-                    graph.edges.emplace_back(to, from, weight);
-                }
-                count--;
+    // Row block boundaries with about the same number of candidate columns in every block
+    [[nodiscard]] DefinitelyNotAVector<int> balancedBlocks(const int vertices, const bool isDirected) const {
+        const int blockCount = std::min(vertices, threads * BLOCKS_PER_THREAD);
+        const int64_t totalWork = isDirected
+            ? static_cast<int64_t>(vertices) * vertices
+            : static_cast<int64_t>(vertices) * (vertices + 1) / 2;
+
+        DefinitelyNotAVector<int> blocks;
+        blocks.reserve(blockCount + 1);
+        blocks.push_back(0);
+        int64_t work = 0;
+        for (int u = 0; u < vertices; u++) {
+            work += isDirected ? vertices : vertices - u;
+            if (work * blockCount >= totalWork * static_cast<int64_t>(blocks.size())) {
+                blocks.push_back(u + 1);
             }
         }
+        if (blocks.back() != vertices) blocks.push_back(vertices);
+        return blocks;
     }
 
-    static bool edgeExists(const GraphData& graph, int from, int to)
-    {
-        return std::ranges::any_of(graph.edges,
-                                   [from, to](const DefinitelyNotATuple<int, int, int>& e)
-                                   {
-                                       return e.get<0>() == from && e.get<1>() == to;
-                                   });
+    /**
+     * Picks quota free columns of row u and emits them as edges offset, offset + 1, ... in increasing column order.
+     * Sparse rows draw the columns they take, dense rows draw the columns they leave out; either way at most half of
+     * the candidates is marked, so a draw hits a free column at least every second try.
+     */
+    template<typename Emit>
+    void generateRow(const Plan& plan, const int u, int64_t offset, const int64_t quota, RowScratch& scratch,
+                     Emit& emitEdge) const {
+        if (quota == 0) return;
+
+        const int vertices = plan.vertices;
+        const bool isDirected = plan.isDirected;
+        const Backbone& backbone = plan.backbone;
+        const int candidateCount = isDirected ? vertices - 1 : vertices - 1 - u;
+        // Candidate k of the row - every other vertex for arcs, the larger vertices for undirected edges
+        auto columnOf = [&](const int k) {
+            return isDirected ? (k < u ? k : k + 1) : u + 1 + k;
+        };
+
+        CounterRandom random(seed, static_cast<uint64_t>(u) + 1);
+        auto& taken = scratch.taken;
+        auto& picked = scratch.picked;
+        picked.clear();
+
+        const int reserved = backbone.count[u];
+        for (int i = 0; i < reserved; i++) {
+            taken.set(backbone.columns[2 * static_cast<size_t>(u) + i]);
+        }
+
+        const int64_t freeCount = candidateCount - reserved;
+        const bool drawTaken = quota * 2 <= freeCount;
+        int64_t draws = drawTaken ? quota : freeCount - quota;
+        while (draws > 0) {
+            const int column = columnOf(static_cast<int>(random.below(static_cast<uint32_t>(candidateCount))));
+            if (!taken.test(column)) {
+                taken.set(column);
+                picked.push_back(column);
+                draws--;
+            }
+        }
+
+        auto emit = [&](const int column) {
+            emitEdge(static_cast<size_t>(offset++), u, column, random.between(plan.minWeight, plan.maxWeight));
+        };
+
+        if (drawTaken) {
+            std::sort(picked.begin(), picked.end());
+            for (const int column : picked) {
+                emit(column);
+            }
+        } else {
+            for (int k = 0; k < candidateCount; k++) {
+                if (const int column = columnOf(k); !taken.test(column)) {
+                    emit(column);
+                }
+            }
+        }
+
+        for (const int column : picked) {
+            taken.reset(column);
+        }
+        for (int i = 0; i < reserved; i++) {
+            taken.reset(backbone.columns[2 * static_cast<size_t>(u) + i]);
+        }
     }
 };
 
-#endif //RANDOMGRAPHGENERATOR_H
\ No newline at end of file
+#endif //RANDOMGRAPHGENERATOR_H
@@ -0,0 +1,138 @@
+#ifndef GRAPHMENUBASE_H
+#define GRAPHMENUBASE_H
+
+#include "MenuBase.h"
+#include "../../Utils/Representations/AdjacencyList.h"
+#include "../../Utils/Representations/AdjancencyMatrix.h"
+#include "../../Infrastructure/FileReader.h"
+#include "../../Infrastructure/GraphSnapshot.h"
+#include "../../Infrastructure/RandomGraphGenerator.h"
+#include "../../Infrastructure/GraphConverter.h"
+
+// Menu of one problem type - the problem decides at compile time whether its graphs are directed
+template<bool Directed>
+class GraphMenuBase : public MenuBase
+{
+protected:
+    AdjacencyList<Directed> listGraph;
+    AdjacencyMatrix<Directed> matrixGraph;
+    bool graphLoaded = false;
+
+public:
+    GraphMenuBase() : listGraph(0), matrixGraph(0), graphLoaded(false) {}
+
+protected:
+    void loadFromFile(const GraphProblemType type) {
+        try {
+            const auto graphData = FileReader::readGraphFromFile(type);
+            convertToRepresentations(graphData);
+            displayBothRepresentations();
+            std::cout << "Graph loaded successfully!\n";
+            waitForEnter();
+        } catch (const std::exception& e) {
+            std::cout << "Error loading graph: " << e.what() << "\n";
+            waitForEnter();
+        }
+    }
+
+    void generateRandom(const int vertices, const int density) {
+        try {
+            if (vertices <= 0) {
+                std::cout << "Error: Number of vertices must be positive\n";
+                waitForEnter();
+                return;
+            }
+            
+            if (density < 0 || density > 100) {
+                std::cout << "Error: Density must be between 0 and 100\n";
+                waitForEnter();
+                return;
+            }
+            
+            // Both representations are generated from the same seed, so they hold the same graph
+            RandomGraphGenerator generator;
+            listGraph = generator.generateAdjacencyList<Directed>(vertices, density);
+            matrixGraph = generator.generateAdjacencyMatrix<Directed>(vertices, density);
+            graphLoaded = true;
+            displayBothRepresentations();
+            std::cout << "Random graph generated successfully (seed " << generator.getSeed() << ")!\n";
+            waitForEnter();
+        } catch (const std::exception& e) {
+            std::cout << "Error generating graph: " << e.what() << "\n";
+            waitForEnter();
+        }
+    }
+
+    // Maps a snapshot and hands its CSR graph to run(graph) - the arrays stay in the mapped pages and nothing is copied,
+    // so graphs too large to load into both representations can still be solved
+    template<typename Run>
+    void runOnSnapshot(Run&& run) {
+        std::string fileName;
+        std::cout << "Enter the snapshot file name (full file path): ";
+        std::cin >> fileName;
+
+        // Clear input buffer
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+        try {
+            const auto graph = GraphSnapshot::openAny<Directed>(fileName);
+            std::visit([&run](const auto& csrGraph) { run(csrGraph); }, graph);
+        } catch (const std::exception& e) {
+            std::cout << "Error: " << e.what() << "\n";
+        }
+    }
+
+    // Reads a vertex of a graph with vertexCount vertices, false when it is out of range
+    static bool readVertex(const std::string& prompt, const int vertexCount, int& vertex) {
+        std::cout << "Enter " << prompt << " vertex (0 to " << vertexCount - 1 << "): ";
+        std::cin >> vertex;
+        return !std::cin.fail() && vertex >= 0 && vertex < vertexCount;
+    }
+
+    void convertToRepresentations(const GraphData& data) {
+        listGraph = GraphConverter::graphDataToAdjList<Directed>(data);
+        matrixGraph = GraphConverter::graphDataToAdjMatrix<Directed>(data);
+        graphLoaded = true;
+    }
+
+    void displayBothRepresentations() const {
+        if (!graphLoaded) {
+            std::cout << "No graph loaded!\n";
+            return;
+        }
+
+        std::cout << "\nAdjacency List Representation:\n";
+        displayListRepresentation();
+
+        std::cout << "\nAdjacency Matrix Representation:\n";
+        displayMatrixRepresentation();
+    }
+
+    void displayListRepresentation() const {
+        for (int i = 0; i < listGraph.getVertexCount(); i++) {
+            std::cout << i << " -> ";
+            for (const auto& edge : listGraph.getAdjacent(i)) {
+                std::cout << "(" << edge.destination << "," << edge.weight << ") ";
+            }
+            std::cout << "\n";
+        }
+    }
+
+    void displayMatrixRepresentation() const {
+        for (int i = 0; i < matrixGraph.getVertexCount(); i++) {
+            for (int j = 0; j < matrixGraph.getVertexCount(); j++) {
+                if (const int weight = matrixGraph.getWeight(i, j); weight == matrixGraph.getNoEdgeValue())
+                {
+                    std::cout << "∞ ";
+                }
+                else
+                {
+                    std::cout << weight << " ";
+                }
+            }
+            std::cout << "\n";
+        }
+    }
+};
+
+#endif //GRAPHMENUBASE_H
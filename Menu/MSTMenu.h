@@ -1,14 +1,16 @@
 #ifndef MSTMENU_H
 #define MSTMENU_H
 
-#include "Abstractions/MenuBase.h"
+#include "Abstractions/GraphMenuBase.h"
 #include "../Algorithms/Prim.h"
 #include "../Algorithms/Kruskal.h"
+#include "../Algorithms/GomoryHu.h"
+#include "../Algorithms/ExternalKruskal.h"
 
-class MSTMenu : public MenuBase
+class MSTMenu : public GraphMenuBase<false>
 {
 public:
-    MSTMenu() : MenuBase() {}
+    MSTMenu() : GraphMenuBase() {}
 
     void show() {
         std::vector<std::string> entries = {
@@ -17,7 +19,10 @@ public:
             "3. Display representations",
             "4. Run Prim's algorithm",
             "5. Run Kruskal's algorithm",
-            "6. Back to main menu"
+            "6. Build Gomory-Hu tree (weights as capacities)",
+            "7. Run out-of-core Kruskal on an edge file",
+            "8. Run Prim's and Kruskal's algorithms on a snapshot in place (memory-mapped, nothing loaded)",
+            "9. Back to main menu"
         };
 
         runMenu("Minimum Spanning Tree Problem", entries, [this](int selected) {
@@ -35,7 +40,7 @@ public:
                     // Clear input buffer
                     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                     
-                    generateRandom(vertices, density, false);
+                    generateRandom(vertices, density);
                     break;
                 }
                 case 2:
@@ -61,6 +66,23 @@ public:
                     }
                     break;
                 case 5:
+                    if (graphLoaded) {
+                        runGomoryHu();
+                        waitForEnter();
+                    } else {
+                        std::cout << "No graph loaded!\n";
+                        waitForEnter();
+                    }
+                    break;
+                case 6:
+                    runExternalKruskal();
+                    waitForEnter();
+                    break;
+                case 7:
+                    runMSTOnSnapshot();
+                    waitForEnter();
+                    break;
+                case 8:
                     return;
                 default:
                     break;
@@ -76,11 +98,81 @@ private:
     }
 
     void runKruskal() {
-        auto listResult = KruskalAlgorithm<AdjacencyList>::findMST(listGraph);
-        auto matrixResult = KruskalAlgorithm<AdjacencyMatrix>::findMST(matrixGraph);
+        auto listResult = KruskalList::findMST(listGraph);
+        auto matrixResult = KruskalMatrix::findMST(matrixGraph);
         displayMSTResults("Kruskal's", listResult, matrixResult);
     }
 
+    // Works on the file directly, so the graph never has to fit into memory
+    void runExternalKruskal() {
+        std::string fileName;
+        long long budgetMegabytes;
+        std::cout << "Enter the file name (full file path): ";
+        std::cin >> fileName;
+        std::cout << "Enter memory budget in MiB: ";
+        std::cin >> budgetMegabytes;
+
+        if (std::cin.fail() || budgetMegabytes <= 0) {
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            std::cout << "Invalid memory budget - enter a positive number of MiB.\n";
+            return;
+        }
+
+        // Clear input buffer
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+        try {
+            const auto result = ExternalKruskal<>::findMST(fileName, static_cast<size_t>(budgetMegabytes) << 20);
+            std::cout << "\nOut-of-core Kruskal's Algorithm Results:\n";
+            displaySingleMSTResult(result);
+        } catch (const std::exception& e) {
+            std::cout << "Error: " << e.what() << "\n";
+        }
+    }
+
+    void runMSTOnSnapshot() {
+        runOnSnapshot([this]<typename Graph>(const Graph& graph) {
+            std::cout << "\nPrim's Algorithm Results (snapshot):\n";
+            displaySingleMSTResult(Prim<Graph>::findMST(graph));
+            std::cout << "Kruskal's Algorithm Results (snapshot):\n";
+            displaySingleMSTResult(KruskalAlgorithm<Graph>::findMST(graph));
+        });
+    }
+
+    void runGomoryHu() {
+        auto listTree = GomoryHuList::buildTree(listGraph);
+        auto matrixTree = GomoryHuMatrix::buildTree(matrixGraph);
+
+        std::cout << "\nGomory-Hu Tree Results:\n";
+        std::cout << "\nList Representation Results:\n";
+        displayGomoryHuTree(listTree);
+        std::cout << "\nMatrix Representation Results:\n";
+        displayGomoryHuTree(matrixTree);
+
+        int u, v;
+        std::cout << "Enter two vertices for a min-cut query: ";
+        std::cin >> u >> v;
+
+        // Clear input buffer
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+        if (u < 0 || u >= listGraph.getVertexCount() || v < 0 || v >= listGraph.getVertexCount() || u == v) {
+            std::cout << "Invalid vertices!\n";
+            return;
+        }
+
+        std::cout << "Min cut between " << u << " and " << v << " (list): " << listTree.minCut(u, v) << "\n";
+        std::cout << "Min cut between " << u << " and " << v << " (matrix): " << matrixTree.minCut(u, v) << "\n";
+    }
+
+    void displayGomoryHuTree(const GomoryHuTree& tree) {
+        for (int v = 1; v < static_cast<int>(tree.parent.size()); v++) {
+            std::cout << v << " -- " << tree.parent[v] << " (min cut: " << tree.weight[v] << ")\n";
+        }
+        std::cout << "\n";
+    }
+
     void displayMSTResults(const std::string& algorithm,
                          const MSTResult& listResult,
                          const MSTResult& matrixResult) {
@@ -18,7 +18,8 @@ public:
             "1. Shortest Path Problem",
             "2. Minimum Spanning Tree",
             "3. Maximum Flow",
-            "4. Exit"
+            "4. Convert a graph file to a binary snapshot",
+            "5. Exit"
         };
 
         runMenu("Graph Algorithm Solver", entries, [this](int selected) {
@@ -39,12 +40,49 @@ public:
                     break;
                 }
                 case 3:
+                    convertToSnapshot();
+                    waitForEnter();
+                    break;
+                case 4:
                     exit(0);
                 default:
                     break;
             }
         });
     }
+
+private:
+    // Parses a text or benchmark-format file once, later loads of the snapshot skip the parsing
+    void convertToSnapshot() {
+        std::string inputName, outputName;
+        int problem;
+        std::cout << "Enter the file name to convert (full file path): ";
+        std::cin >> inputName;
+        std::cout << "Problem type of the graph (1 - shortest path, 2 - MST, 3 - max flow): ";
+        std::cin >> problem;
+        std::cout << "Enter the snapshot file name: ";
+        std::cin >> outputName;
+
+        // Clear input buffer
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+        const GraphProblemType problemTypes[] = {
+            GraphProblemType::SHORTEST_PATH, GraphProblemType::MST, GraphProblemType::MAX_FLOW
+        };
+        if (problem < 1 || problem > 3) {
+            std::cout << "Invalid problem type!\n";
+            return;
+        }
+
+        try {
+            const auto graphData = FileReader::readGraphFromFile(inputName, problemTypes[problem - 1]);
+            GraphSnapshot::write(outputName, graphData);
+            std::cout << "Saved " << graphData.numVertices << " vertices and " << graphData.edges.size()
+                      << " edges to " << outputName << "\n";
+        } catch (const std::exception& e) {
+            std::cout << "Error: " << e.what() << "\n";
+        }
+    }
 };
 
 #endif //MAINMENU_H
\ No newline at end of file
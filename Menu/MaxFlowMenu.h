@@ -1,13 +1,14 @@
 #ifndef MAXFLOWMENU_H
 #define MAXFLOWMENU_H
 
-#include "Abstractions/MenuBase.h"
+#include "Abstractions/GraphMenuBase.h"
 #include "../Algorithms/FordFulkerson.h"
+#include "../Algorithms/IncrementalMaxFlow.h"
 #include "../Utils/Results/FlowResult.h"
 
-class MaxFlowMenu : public MenuBase {
+class MaxFlowMenu : public GraphMenuBase<true> {
 public:
-    MaxFlowMenu() : MenuBase() {}
+    MaxFlowMenu() : GraphMenuBase() {}
 
     void show() {
         std::vector<std::string> entries = {
@@ -16,7 +17,11 @@ public:
             "3. Display representations",
             "4. Run Ford-Fulkerson algorithm with BFS",
             "5. Run Ford-Fulkerson algorithm with DFS",
-            "6. Back to main menu"
+            "6. Run Ford-Fulkerson algorithm with direction-optimizing BFS",
+            "7. Run Ford-Fulkerson algorithm with capacity scaling",
+            "8. Change capacities and re-solve incrementally",
+            "9. Run Ford-Fulkerson algorithm with BFS on a snapshot in place (memory-mapped, nothing loaded)",
+            "10. Back to main menu"
         };
 
         runMenu("Maximum Flow Problem", entries, [this](int selected) {
@@ -34,7 +39,7 @@ public:
                     // Clear input buffer
                     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                     
-                    generateRandom(vertices, density, true);
+                    generateRandom(vertices, density);
                     break;
                 }
                 case 2:
@@ -60,6 +65,37 @@ public:
                     }
                     break;
                 case 5:
+                    if (graphLoaded) {
+                        runFordFulkerson(SearchMethod::DIRECTION_OPTIMIZING_BFS);
+                        waitForEnter();
+                    } else {
+                        std::cout << "No graph loaded!\n";
+                        waitForEnter();
+                    }
+                    break;
+                case 6:
+                    if (graphLoaded) {
+                        runFordFulkerson(SearchMethod::CAPACITY_SCALING);
+                        waitForEnter();
+                    } else {
+                        std::cout << "No graph loaded!\n";
+                        waitForEnter();
+                    }
+                    break;
+                case 7:
+                    if (graphLoaded) {
+                        runIncrementalMaxFlow();
+                        waitForEnter();
+                    } else {
+                        std::cout << "No graph loaded!\n";
+                        waitForEnter();
+                    }
+                    break;
+                case 8:
+                    runFordFulkersonOnSnapshot();
+                    waitForEnter();
+                    break;
+                case 9:
                     return;
                 default:
                     break;
@@ -85,7 +121,7 @@ private:
             return;
         }
 
-        std::string methodName = (method == SearchMethod::BFS) ? "BFS" : "DFS";
+        std::string methodName = getSearchMethodName(method);
         std::cout << "\nRunning Ford-Fulkerson with " << methodName << " search method\n";
 
         auto listResult = FordFulkersonList::findMaxFlow(listGraph, source, sink, method);
@@ -93,6 +129,74 @@ private:
         displayFlowResults("Ford-Fulkerson with " + methodName, listResult, matrixResult);
     }
 
+    void runFordFulkersonOnSnapshot() {
+        runOnSnapshot([this]<typename Graph>(const Graph& graph) {
+            int source, sink;
+            const bool valid = readVertex("source", graph.getVertexCount(), source)
+                               && readVertex("sink", graph.getVertexCount(), sink) && source != sink;
+
+            // Clear input buffer
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+            if (!valid) {
+                std::cout << "Invalid vertices!\n";
+                return;
+            }
+
+            std::cout << "\nFord-Fulkerson with BFS Algorithm Results (snapshot):\n";
+            displaySingleFlowResult(FordFulkerson<Graph>::findMaxFlow(graph, source, sink, SearchMethod::BFS));
+        });
+    }
+
+    static std::string getSearchMethodName(SearchMethod method) {
+        switch (method) {
+            case SearchMethod::BFS: return "BFS";
+            case SearchMethod::DFS: return "DFS";
+            case SearchMethod::DIRECTION_OPTIMIZING_BFS: return "direction-optimizing BFS";
+            case SearchMethod::CAPACITY_SCALING: return "capacity scaling";
+            default: return "Unknown";
+        }
+    }
+
+    void runIncrementalMaxFlow() {
+        int source, sink;
+        std::cout << "Enter source vertex (0 to " << matrixGraph.getVertexCount() - 1 << "): ";
+        std::cin >> source;
+        std::cout << "Enter sink vertex (0 to " << matrixGraph.getVertexCount() - 1 << "): ";
+        std::cin >> sink;
+
+        if (source < 0 || source >= matrixGraph.getVertexCount() ||
+            sink < 0 || sink >= matrixGraph.getVertexCount() ||
+            source == sink) {
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            std::cout << "Invalid vertices!\n";
+            return;
+        }
+
+        IncrementalMaxFlow solver(matrixGraph, source, sink);
+        std::cout << "Initial maximum flow: " << solver.solve() << "\n";
+
+        while (true) {
+            int from, to, capacity;
+            std::cout << "Enter arc and new capacity (from to capacity), or -1 to finish: ";
+            std::cin >> from;
+            if (from == -1) break;
+            std::cin >> to >> capacity;
+
+            try {
+                solver.setCapacity(from, to, capacity);
+                std::cout << "Maximum flow after the change: " << solver.solve() << "\n";
+            } catch (const std::exception& e) {
+                std::cout << "Error: " << e.what() << "\n";
+            }
+        }
+
+        // Clear input buffer
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        displaySingleFlowResult(solver.getResult());
+    }
+
     void displayFlowResults(const std::string& algorithm,
                           const FlowResult& listResult,
                           const FlowResult& matrixResult) {
@@ -116,6 +220,17 @@ private:
                 }
             }
         }
+        std::cout << "\nMinimum Cut (source side): ";
+        for (int v = 0; v < static_cast<int>(result.sourceSide.size()); v++) {
+            if (result.isOnSourceSide(v)) {
+                std::cout << v << " ";
+            }
+        }
+        std::cout << "\nCut Edges:\n";
+        for (const auto& edge : result.cutEdges) {
+            std::cout << edge.source << " -> " << edge.destination << ": " << edge.weight << "\n";
+        }
+        std::cout << "Cut Capacity: " << result.cutCapacity() << "\n";
         std::cout << "\n";
     }
 };
@@ -1,13 +1,14 @@
 #ifndef SSPMENU_H
 #define SSPMENU_H
 
-#include "Abstractions/MenuBase.h"
+#include "Abstractions/GraphMenuBase.h"
 #include "../Algorithms/Dijkstra.h"
 #include "../Algorithms/BellmanFord.h"
+#include "../Algorithms/MultiSourceBFS.h"
 
-class SSPMenu : public MenuBase {
+class SSPMenu : public GraphMenuBase<true> {
 public:
-    SSPMenu() : MenuBase() {}
+    SSPMenu() : GraphMenuBase() {}
 
     void show() {
         std::vector<std::string> entries = {
@@ -16,7 +17,9 @@ public:
             "3. Display representations",
             "4. Run Dijkstra's algorithm",
             "5. Run Bellman-Ford algorithm",
-            "6. Back to main menu"
+            "6. Run multi-source BFS (hop counts from every vertex)",
+            "7. Run Dijkstra's algorithm on a snapshot in place (memory-mapped, nothing loaded)",
+            "8. Back to main menu"
         };
 
         runMenu("Shortest Path Problem", entries, [this](int selected) {
@@ -34,7 +37,7 @@ public:
                     // Clear input buffer
                     std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
                     
-                    generateRandom(vertices, density, true);
+                    generateRandom(vertices, density);
                     break;
                 }
                 case 2:
@@ -60,6 +63,19 @@ public:
                     }
                     break;
                 case 5:
+                    if (graphLoaded) {
+                        runMultiSourceBFS();
+                        waitForEnter();
+                    } else {
+                        std::cout << "No graph loaded!\n";
+                        waitForEnter();
+                    }
+                    break;
+                case 6:
+                    runDijkstraOnSnapshot();
+                    waitForEnter();
+                    break;
+                case 7:
 
                 default:
                     break;
@@ -104,6 +120,55 @@ private:
         displayPathResults("Bellman-Ford", listResult, matrixResult, source);
     }
 
+    void runDijkstraOnSnapshot() {
+        runOnSnapshot([this]<typename Graph>(const Graph& graph) {
+            int source;
+            const bool valid = readVertex("source", graph.getVertexCount(), source);
+
+            // Clear input buffer
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+            if (!valid) {
+                std::cout << "Invalid source vertex!\n";
+                return;
+            }
+
+            std::cout << "\nDijkstra's Algorithm Results (snapshot):\n";
+            displaySinglePathResult(Dijkstra<Graph>::findShortestPath(graph, source), source);
+        });
+    }
+
+    void runMultiSourceBFS() {
+        DefinitelyNotAVector<int> sources(listGraph.getVertexCount());
+        for (int i = 0; i < listGraph.getVertexCount(); i++) {
+            sources[i] = i;
+        }
+
+        auto listResult = MultiSourceBFSList::run(listGraph, sources);
+        auto matrixResult = MultiSourceBFSMatrix::run(matrixGraph, sources);
+
+        std::cout << "\nMulti-source BFS Results:\n";
+        std::cout << "\nList Representation Results:\n";
+        displayHopResult(listResult);
+        std::cout << "\nMatrix Representation Results:\n";
+        displayHopResult(matrixResult);
+    }
+
+    void displayHopResult(const MultiSourceBFSResult& result) {
+        for (size_t i = 0; i < result.sources.size(); i++) {
+            std::cout << "From " << result.sources[i] << " (reaches " << result.reachable[i].count() << "): ";
+            for (const int hops : result.hops[i]) {
+                if (hops == -1) {
+                    std::cout << "∞ ";
+                } else {
+                    std::cout << hops << " ";
+                }
+            }
+            std::cout << "\n";
+        }
+    }
+
     void displayPathResults(const std::string& algorithm,
                           const PathResult& listResult,
                           const PathResult& matrixResult,
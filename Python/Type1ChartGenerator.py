@@ -22,7 +22,7 @@ class Type1ChartGenerator:
         self.problem_types = {
             'MST': ['Kruskal', 'Prim'],
             'SHORTEST_PATH': ['Dijkstra', 'Bellman-Ford'],
-            'MAX_FLOW': ['Ford-Fulkerson-DFS', 'Ford-Fulkerson-BFS']
+            'MAX_FLOW': ['Ford-Fulkerson-DFS', 'Ford-Fulkerson-BFS', 'Ford-Fulkerson-DOBFS', 'Ford-Fulkerson-Scaling']
         }
 
     def find_type1_csv_files(self, pattern="*_type1_*.csv"):
@@ -63,7 +63,7 @@ class Type1ChartGenerator:
             vertex_counts = df['VertexCount'].values
 
             # Plot each algorithm-density combination
-            algorithm_density_columns = [col for col in df.columns if col != 'VertexCount']
+            algorithm_density_columns = [col for col in df.columns if col not in ('VertexCount', 'Seed')]
 
             for algo_density_col in algorithm_density_columns:
                 # Get execution times for this algorithm-density combination
@@ -127,7 +127,9 @@ class Type1ChartGenerator:
                     "Dijkstra": "Dijkstra",
                     "Bellman-Ford": "Bellman-Ford",
                     "Ford-Fulkerson-DFS": "Ford-Fulkerson (DFS)",
-                    "Ford-Fulkerson-BFS": "Ford-Fulkerson (BFS)"
+                    "Ford-Fulkerson-BFS": "Ford-Fulkerson (BFS)",
+                    "Ford-Fulkerson-DOBFS": "Ford-Fulkerson (DO-BFS)",
+                    "Ford-Fulkerson-Scaling": "Ford-Fulkerson (scaling)"
                 }
                 
                 formatted_algorithm = algorithm_map.get(algorithm, algorithm)
@@ -197,7 +199,7 @@ class Type1ChartGenerator:
                 representation = self._extract_representation_from_filename(csv_file.stem)
 
                 vertex_counts = df['VertexCount'].values
-                algorithm_density_columns = [col for col in df.columns if col != 'VertexCount']
+                algorithm_density_columns = [col for col in df.columns if col not in ('VertexCount', 'Seed')]
 
                 for i, algo_density_col in enumerate(algorithm_density_columns):
                     times = df[algo_density_col].values
@@ -59,7 +59,7 @@ class Type2ChartGenerator:
             vertex_counts = df['VertexCount'].values
 
             # Plot each algorithm-representation combination
-            algorithm_rep_columns = [col for col in df.columns if col != 'VertexCount']
+            algorithm_rep_columns = [col for col in df.columns if col not in ('VertexCount', 'Seed')]
 
             for algo_rep_col in algorithm_rep_columns:
                 # Get execution times for this algorithm-representation combination
@@ -129,7 +129,9 @@ class Type2ChartGenerator:
                     "Dijkstra": "Dijkstra",
                     "Bellman-Ford": "Bellman-Ford",
                     "Ford-Fulkerson-DFS": "Ford-Fulkerson (DFS)",
-                    "Ford-Fulkerson-BFS": "Ford-Fulkerson (BFS)"
+                    "Ford-Fulkerson-BFS": "Ford-Fulkerson (BFS)",
+                    "Ford-Fulkerson-DOBFS": "Ford-Fulkerson (DO-BFS)",
+                    "Ford-Fulkerson-Scaling": "Ford-Fulkerson (scaling)"
                 }
                 
                 # Format representation name
@@ -152,7 +154,7 @@ class Type2ChartGenerator:
         elif problem_type.upper() in ["SSP", "SHORTEST_PATH"]:
             return ["Dijkstra", "Bellman-Ford"]
         elif problem_type.upper() == "MAX_FLOW":
-            return ["Ford-Fulkerson-DFS", "Ford-Fulkerson-BFS"]
+            return ["Ford-Fulkerson-DFS", "Ford-Fulkerson-BFS", "Ford-Fulkerson-DOBFS", "Ford-Fulkerson-Scaling"]
         return []
 
     def _format_problem_type(self, problem_type):
@@ -204,7 +206,7 @@ class Type2ChartGenerator:
                 density = self._extract_density_from_filename(csv_file.stem)
 
                 vertex_counts = df['VertexCount'].values
-                algorithm_rep_columns = [col for col in df.columns if col != 'VertexCount']
+                algorithm_rep_columns = [col for col in df.columns if col not in ('VertexCount', 'Seed')]
 
                 for i, algo_rep_col in enumerate(algorithm_rep_columns):
                     times = df[algo_rep_col].values
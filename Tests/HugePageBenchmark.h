@@ -0,0 +1,100 @@
+#ifndef HUGEPAGEBENCHMARK_H
+#define HUGEPAGEBENCHMARK_H
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../Algorithms/BellmanFord.h"
+#include "../Algorithms/Prim.h"
+#include "../Utils/Enums/MemoryPolicy.h"
+#include "../Utils/Representations/AdjancencyMatrix.h"
+#include "TlbMissCounter.h"
+
+/**
+ * Runs BellmanFordMatrix and PrimMatrix on the same matrix stored on regular and on huge pages,
+ * and prints the average runtime and data-TLB load misses of both.
+ */
+class HugePageBenchmark
+{
+public:
+    static void Run(const int density = 99, const int repetitions = 3)
+    {
+        std::cout << "=== Huge page comparison (" << density << "% density, " << repetitions << " runs each) ===" << std::endl;
+
+        TlbMissCounter counter;
+        if (!counter.available()) {
+            std::cout << "dTLB miss counter unavailable (perf_event_open refused), only times are reported" << std::endl;
+        }
+
+        std::cout << std::left << std::setw(14) << "Algorithm" << std::setw(10) << "Vertices" << std::setw(12) << "Pages"
+                  << std::setw(14) << "Time [ms]" << "dTLB misses" << std::endl;
+
+        // Bellman-Ford scans the whole matrix V - 1 times, so it stays at smaller sizes
+        for (const int vertexCount : std::vector<int>{500, 1000, 1500}) {
+            compare<true>("Bellman-Ford", vertexCount, density, repetitions, counter, [](const DirectedAdjacencyMatrix& graph) {
+                BellmanFordMatrix::findShortestPath(graph, 0);
+            });
+        }
+
+        for (const int vertexCount : std::vector<int>{2000, 5000, 10000}) {
+            compare<false>("Prim", vertexCount, density, repetitions, counter, [](const UndirectedAdjacencyMatrix& graph) {
+                PrimMatrix::findMST(graph);
+            });
+        }
+    }
+
+private:
+    // Both policies get the same cells, filled directly because the edge list generator is too slow at these sizes
+    template<bool Directed>
+    static void fillRandom(AdjacencyMatrix<Directed>& graph, const int density, const unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> percent(0, 99);
+        std::uniform_int_distribution<int> weight(1, 100);
+        const int V = graph.getVertexCount();
+
+        for (int u = 0; u < V; u++) {
+            for (int v = Directed ? 0 : u + 1; v < V; v++) {
+                if (u != v && percent(rng) < density) {
+                    graph.addEdge(u, v, weight(rng));
+                }
+            }
+        }
+    }
+
+    template<bool Directed, typename Run>
+    static void compare(const std::string& name, const int vertexCount, const int density, const int repetitions,
+                        TlbMissCounter& counter, Run&& run)
+    {
+        for (const auto memory : {MemoryPolicy::STANDARD, MemoryPolicy::HUGE_PAGES}) {
+            AdjacencyMatrix<Directed> graph(vertexCount, memory);
+            fillRandom(graph, density, static_cast<unsigned>(vertexCount));
+
+            double totalTime = 0;
+            long long totalMisses = 0;
+            for (int i = 0; i < repetitions; i++) {
+                counter.start();
+                const auto start_time = std::chrono::high_resolution_clock::now();
+                run(graph);
+                const auto end_time = std::chrono::high_resolution_clock::now();
+                totalMisses += counter.stop();
+                totalTime += std::chrono::duration<double, std::milli>(end_time - start_time).count();
+            }
+
+            std::cout << std::left << std::setw(14) << name << std::setw(10) << vertexCount
+                      << std::setw(12) << (memory == MemoryPolicy::HUGE_PAGES ? "huge" : "regular")
+                      << std::setw(14) << std::fixed << std::setprecision(2) << totalTime / repetitions;
+            if (counter.available()) {
+                std::cout << totalMisses / repetitions;
+            } else {
+                std::cout << "n/a";
+            }
+            std::cout << std::endl;
+        }
+    }
+};
+
+#endif //HUGEPAGEBENCHMARK_H
@@ -1,39 +1,47 @@
 #ifndef REPORTGENERATOR_H
 #define REPORTGENERATOR_H
 #include <memory>
+#include <variant>
 #include <vector>
 #include <chrono>
 #include <numeric>
 #include <iostream>
 #include <optional>
+#include <utility>
 
 #include "../Algorithms/BellmanFord.h"
 #include "../Algorithms/Dijkstra.h"
 #include "../Algorithms/FordFulkerson.h"
 #include "../Algorithms/Kruskal.h"
 #include "../Algorithms/Prim.h"
+#include "../Infrastructure/GraphCache.h"
 #include "../Infrastructure/GraphConverter.h"
-#include "../Infrastructure/RandomGraphGenerator.h"
 #include "../Utils/Data/GraphDataHandler.h"
+#include "../Utils/Enums/GraphFamily.h"
 #include "../Utils/Enums/GraphRepresentationType.h"
+#include "../Utils/Memory/AlgorithmWorkspace.h"
+#include "../Utils/Representations/GraphVariant.h"
 
 class ReportGenerator
 {
 public:
     ReportGenerator() = default;
 
-    static std::vector<GraphDataHandler> GenerateType1Report(const Algorithm algorithm, const int density, const int generationCount, const int vertexCount, const GraphRepresentationType representation)
+    static std::vector<GraphDataHandler> GenerateType1Report(const Algorithm algorithm, const int density, const int generationCount, const int vertexCount, const GraphRepresentationType representation, const uint64_t seed, const GraphFamily family = GraphFamily::UNIFORM)
     {
         std::vector<long> type1ReportTimes; // Changed to long to avoid overflow
         type1ReportTimes.reserve(generationCount);
 
+        // Shared by every run of the report - after the first run the scratch memory is already reserved
+        AlgorithmWorkspace workspace;
+
         for (int i = 0; i < generationCount; i++)
         {
-            std::cout << "Generating graph " << i + 1 << " of " << generationCount << " ";
+            std::cout << "Graph " << i + 1 << " of " << generationCount << " ";
             std::cout << "Algorithm: " << GetAlgorithmName(algorithm) << " ";
             std::cout << "(" << GetRepresentationName(representation) << ")" << std::endl;
             
-            auto result = GenerateType1ReportEntry(algorithm, density, vertexCount, representation);
+            auto result = GenerateType1ReportEntry(algorithm, density, vertexCount, representation, workspace, seed, family, i);
             if (result.has_value()) {
                 type1ReportTimes.push_back(result.value().MeasuredTime);
             } else {
@@ -50,7 +58,7 @@ public:
         }
 
         std::vector<GraphDataHandler> type1Report;
-        type1Report.emplace_back(algorithm, averageTime, density, representation, vertexCount);
+        type1Report.emplace_back(algorithm, averageTime, density, representation, vertexCount, seed);
 
         std::cout << "Average time for " << GetAlgorithmName(algorithm) << " (" << GetRepresentationName(representation) 
                   << "): " << averageTime << " milisseconds" << std::endl;
@@ -58,6 +66,22 @@ public:
         return type1Report;
     }
 
+    // Seed of graph i of a benchmark run - mixed, so that neighbouring benchmark seeds do not share graphs
+    static uint64_t GraphSeed(const uint64_t seed, const int iteration)
+    {
+        return CounterRandom::mix(seed ^ CounterRandom::mix(static_cast<uint64_t>(iteration)));
+    }
+
+    /**
+     * Graph i of every report is the same instance for all algorithms and representations of its size and density,
+     * and it is kept in ../GraphCache between program runs.
+     */
+    static GraphCache& Cache()
+    {
+        static GraphCache cache("../GraphCache");
+        return cache;
+    }
+
 private:
     static std::string GetAlgorithmName(const Algorithm algorithm)
     {
@@ -69,6 +93,8 @@ private:
             case Algorithm::BELLMAN_FORD: return "Bellman-Ford";
             case Algorithm::FORD_FULKERSON_DFS: return "Ford-Fulkerson (DFS)";
             case Algorithm::FORD_FULKERSON_BFS: return "Ford-Fulkerson (BFS)";
+            case Algorithm::FORD_FULKERSON_DOBFS: return "Ford-Fulkerson (DO-BFS)";
+            case Algorithm::FORD_FULKERSON_SCALING: return "Ford-Fulkerson (capacity scaling)";
             default: return "Unknown";
         }
     }
@@ -83,136 +109,138 @@ private:
         }
     }
 
+    // Visits the variants once so the timed call runs the kernel instantiated for the concrete representation
+    // and accumulator type - run receives the graph and a value of the accumulator type
+    template<bool Directed, typename Run>
+    static double MeasureOnRepresentation(const GraphVariant<Directed>& graph, const AccumulatorVariant& accumulator, Run&& run)
+    {
+        return std::visit([&run]<GraphView Graph, typename Accumulator>(const Graph& concreteGraph, Accumulator accumulatorTag) {
+            const auto start_time = std::chrono::high_resolution_clock::now();
+            run(concreteGraph, accumulatorTag);
+            const auto end_time = std::chrono::high_resolution_clock::now();
+
+            return std::chrono::duration<double, std::milli>(end_time - start_time).count();
+        }, graph, accumulator);
+    }
+
+    /**
+     * Graph of one benchmark run in the tested representation, with the accumulator its weights need.
+     * Graphs too big for the cache are generated straight into the representation - the same seed gives the same graph,
+     * and no GraphData copy is held next to it.
+     */
+    template<bool Directed>
+    static std::pair<GraphVariant<Directed>, AccumulatorVariant> BenchmarkGraph(const int vertexCount, const int density,
+                                                                                const GraphRepresentationType representation,
+                                                                                const uint64_t graphSeed,
+                                                                                const GraphFamily family)
+    {
+        const GraphCacheKey key{vertexCount, density, Directed, graphSeed, family};
+        if (!Cache().fitsInMemory(key)) {
+            RandomGraphGenerator generator(graphSeed);
+            return {generator.generateRepresentation<Directed>(vertexCount, density, representation),
+                    GraphConverter::ChooseAccumulator(RandomGraphGenerator::edgeCount(vertexCount, density, Directed),
+                                                      RandomGraphGenerator::DEFAULT_MIN_WEIGHT,
+                                                      RandomGraphGenerator::DEFAULT_MAX_WEIGHT)};
+        }
+
+        const auto cached = Cache().get(key);
+        return {GraphConverter::ConvertToRepresenstation<Directed>(*cached, representation), GraphConverter::ChooseAccumulator(*cached)};
+    }
+
     static std::optional<GraphDataHandler> GenerateType1ReportEntry(const Algorithm algorithm, const int density,
                                                       const int vertexCount,
-                                                      GraphRepresentationType representation)
+                                                      GraphRepresentationType representation,
+                                                      AlgorithmWorkspace& workspace,
+                                                      const uint64_t seed,
+                                                      const GraphFamily family,
+                                                      const int iteration)
     {
         try {
-            const auto graphGenerator = std::make_unique<RandomGraphGenerator>();
+            workspace.reset();
+
+            const uint64_t graphSeed = GraphSeed(seed, iteration);
 
             switch (algorithm)
             {
                 case Algorithm::KRUSKAL:
                 {
-                    const auto graph = GraphConverter::ConvertToRepresenstation(graphGenerator->generate(vertexCount, density, false), false, representation);
-
-                    const auto start_time = std::chrono::high_resolution_clock::now();
-                    KruskalAlgorithm<GraphRepresentation>::findMST(*graph);
-                    const auto end_time = std::chrono::high_resolution_clock::now();
+                    const auto [graph, accumulator] = BenchmarkGraph<false>(vertexCount, density, representation, graphSeed, family);
 
-                    const auto time = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+                    const auto time = MeasureOnRepresentation(graph, accumulator, [&]<GraphView Graph, typename Accumulator>(const Graph& concreteGraph, Accumulator) {
+                        KruskalAlgorithm<Graph, Accumulator>::findMST(concreteGraph, &workspace);
+                    });
 
-                    return GraphDataHandler(algorithm, time, density, representation, vertexCount);
+                    return GraphDataHandler(algorithm, time, density, representation, vertexCount, seed);
                 }
                 case Algorithm::PRIM:
                 {
-                    const auto graph = GraphConverter::ConvertToRepresenstation(graphGenerator->generate(vertexCount, density, false), false, representation);
-                    std::chrono::time_point<std::chrono::high_resolution_clock> start_time, end_time;
-
-                    if (representation == GraphRepresentationType::ADJACENCY_LIST)
-                    {
-                         start_time = std::chrono::high_resolution_clock::now();
-                        PrimList::findMST(*dynamic_cast<AdjacencyList*>(graph.get()));
-                         end_time = std::chrono::high_resolution_clock::now();
-                    }
-                    else
-                    {
-                         start_time = std::chrono::high_resolution_clock::now();
-                        PrimMatrix::findMST(*dynamic_cast<AdjacencyMatrix*>(graph.get()));
-                         end_time = std::chrono::high_resolution_clock::now();
-                    }
-
-                     const auto time = std::chrono::duration<double, std::milli>(end_time - start_time).count();
-
-                    return GraphDataHandler(algorithm, time, density, representation, vertexCount);
+                    const auto [graph, accumulator] = BenchmarkGraph<false>(vertexCount, density, representation, graphSeed, family);
+
+                    const auto time = MeasureOnRepresentation(graph, accumulator, [&]<GraphView Graph, typename Accumulator>(const Graph& concreteGraph, Accumulator) {
+                        Prim<Graph, Accumulator>::findMST(concreteGraph, &workspace);
+                    });
+
+                    return GraphDataHandler(algorithm, time, density, representation, vertexCount, seed);
                 }
                 case Algorithm::DIJKSTRA:
                 {
-                    const auto graph = GraphConverter::ConvertToRepresenstation(graphGenerator->generate(vertexCount, density, true), true, representation);
-                    std::chrono::time_point<std::chrono::high_resolution_clock> start_time, end_time;
-
-                    if (representation == GraphRepresentationType::ADJACENCY_LIST)
-                    {
-                        start_time = std::chrono::high_resolution_clock::now();
-                        DijkstraList::findShortestPath(*dynamic_cast<AdjacencyList*>(graph.get()), 0);
-                        end_time = std::chrono::high_resolution_clock::now();
-                    }
-                    else
-                    {
-                        start_time = std::chrono::high_resolution_clock::now();
-                        DijkstraMatrix::findShortestPath(*dynamic_cast<AdjacencyMatrix*>(graph.get()), 0);
-                        end_time = std::chrono::high_resolution_clock::now();
-                    }
-
-                    const auto time = std::chrono::duration<double, std::milli>(end_time - start_time).count();
-
-                    return GraphDataHandler(algorithm, time, density, representation, vertexCount);
+                    const auto [graph, accumulator] = BenchmarkGraph<true>(vertexCount, density, representation, graphSeed, family);
+
+                    const auto time = MeasureOnRepresentation(graph, accumulator, [&]<GraphView Graph, typename Accumulator>(const Graph& concreteGraph, Accumulator) {
+                        Dijkstra<Graph, Accumulator>::findShortestPath(concreteGraph, 0, &workspace);
+                    });
+
+                    return GraphDataHandler(algorithm, time, density, representation, vertexCount, seed);
                 }
                 case Algorithm::BELLMAN_FORD:
                 {
-                    const auto graph = GraphConverter::ConvertToRepresenstation(graphGenerator->generate(vertexCount, density, true), true, representation);
-                    std::chrono::time_point<std::chrono::high_resolution_clock> start_time, end_time;
-
-                    if (representation == GraphRepresentationType::ADJACENCY_LIST)
-                    {
-                        start_time = std::chrono::high_resolution_clock::now();
-                        BellmanFordList::findShortestPath(*dynamic_cast<AdjacencyList*>(graph.get()), 0);
-                        end_time = std::chrono::high_resolution_clock::now();
-                    }
-                    else
-                    {
-                        start_time = std::chrono::high_resolution_clock::now();
-                        BellmanFordMatrix::findShortestPath(*dynamic_cast<AdjacencyMatrix*>(graph.get()), 0);
-                        end_time = std::chrono::high_resolution_clock::now();
-                    }
-
-                    const auto time = std::chrono::duration<double, std::milli>(end_time - start_time).count();
-
-                    return GraphDataHandler(algorithm, time, density, representation, vertexCount);
+                    const auto [graph, accumulator] = BenchmarkGraph<true>(vertexCount, density, representation, graphSeed, family);
+
+                    const auto time = MeasureOnRepresentation(graph, accumulator, [&]<GraphView Graph, typename Accumulator>(const Graph& concreteGraph, Accumulator) {
+                        BellmanFord<Graph, Accumulator>::findShortestPath(concreteGraph, 0);
+                    });
+
+                    return GraphDataHandler(algorithm, time, density, representation, vertexCount, seed);
                 }
                 case Algorithm::FORD_FULKERSON_DFS:
                 {
-                    const auto graph = GraphConverter::ConvertToRepresenstation(graphGenerator->generate(vertexCount, density, true), true, representation);
-                    std::chrono::time_point<std::chrono::high_resolution_clock> start_time, end_time;
-
-                    if (representation == GraphRepresentationType::ADJACENCY_LIST)
-                    {
-                        start_time = std::chrono::high_resolution_clock::now();
-                        FordFulkersonList::findMaxFlow(*dynamic_cast<AdjacencyList*>(graph.get()), 0, vertexCount - 1, SearchMethod::DFS);
-                        end_time = std::chrono::high_resolution_clock::now();
-                    }
-                    else
-                    {
-                        start_time = std::chrono::high_resolution_clock::now();
-                        FordFulkersonMatrix::findMaxFlow(*dynamic_cast<AdjacencyMatrix*>(graph.get()), 0, vertexCount - 1, SearchMethod::DFS);
-                        end_time = std::chrono::high_resolution_clock::now();
-                    }
-
-                    const auto time = std::chrono::duration<double, std::milli>(end_time - start_time).count();
-
-                    return GraphDataHandler(algorithm, time, density, representation, vertexCount);
+                    const auto [graph, accumulator] = BenchmarkGraph<true>(vertexCount, density, representation, graphSeed, family);
+
+                    const auto time = MeasureOnRepresentation(graph, accumulator, [&]<GraphView Graph, typename Accumulator>(const Graph& concreteGraph, Accumulator) {
+                        FordFulkerson<Graph, Accumulator>::findMaxFlow(concreteGraph, 0, vertexCount - 1, SearchMethod::DFS, FlowOutputMode::VALUE_ONLY, &workspace);
+                    });
+
+                    return GraphDataHandler(algorithm, time, density, representation, vertexCount, seed);
                 }
                 case Algorithm::FORD_FULKERSON_BFS:
                 {
-                    const auto graph = GraphConverter::ConvertToRepresenstation(graphGenerator->generate(vertexCount, density, true), true, representation);
-                    std::chrono::time_point<std::chrono::high_resolution_clock> start_time, end_time;
-
-                    if (representation == GraphRepresentationType::ADJACENCY_LIST)
-                    {
-                        start_time = std::chrono::high_resolution_clock::now();
-                        FordFulkersonList::findMaxFlow(*dynamic_cast<AdjacencyList*>(graph.get()), 0, vertexCount - 1, SearchMethod::BFS);
-                        end_time = std::chrono::high_resolution_clock::now();
-                    }
-                    else
-                    {
-                        start_time = std::chrono::high_resolution_clock::now();
-                        FordFulkersonMatrix::findMaxFlow(*dynamic_cast<AdjacencyMatrix*>(graph.get()), 0, vertexCount - 1, SearchMethod::BFS);
-                        end_time = std::chrono::high_resolution_clock::now();
-                    }
-
-                    const auto time = std::chrono::duration<double, std::milli>(end_time - start_time).count();
-
-                    return GraphDataHandler(algorithm, time, density, representation, vertexCount);
+                    const auto [graph, accumulator] = BenchmarkGraph<true>(vertexCount, density, representation, graphSeed, family);
+
+                    const auto time = MeasureOnRepresentation(graph, accumulator, [&]<GraphView Graph, typename Accumulator>(const Graph& concreteGraph, Accumulator) {
+                        FordFulkerson<Graph, Accumulator>::findMaxFlow(concreteGraph, 0, vertexCount - 1, SearchMethod::BFS, FlowOutputMode::VALUE_ONLY, &workspace);
+                    });
+
+                    return GraphDataHandler(algorithm, time, density, representation, vertexCount, seed);
+                }
+                case Algorithm::FORD_FULKERSON_DOBFS:
+                {
+                    const auto [graph, accumulator] = BenchmarkGraph<true>(vertexCount, density, representation, graphSeed, family);
+
+                    const auto time = MeasureOnRepresentation(graph, accumulator, [&]<GraphView Graph, typename Accumulator>(const Graph& concreteGraph, Accumulator) {
+                        FordFulkerson<Graph, Accumulator>::findMaxFlow(concreteGraph, 0, vertexCount - 1, SearchMethod::DIRECTION_OPTIMIZING_BFS, FlowOutputMode::VALUE_ONLY, &workspace);
+                    });
+
+                    return GraphDataHandler(algorithm, time, density, representation, vertexCount, seed);
+                }
+                case Algorithm::FORD_FULKERSON_SCALING:
+                {
+                    const auto [graph, accumulator] = BenchmarkGraph<true>(vertexCount, density, representation, graphSeed, family);
+
+                    const auto time = MeasureOnRepresentation(graph, accumulator, [&]<GraphView Graph, typename Accumulator>(const Graph& concreteGraph, Accumulator) {
+                        FordFulkerson<Graph, Accumulator>::findMaxFlow(concreteGraph, 0, vertexCount - 1, SearchMethod::CAPACITY_SCALING, FlowOutputMode::VALUE_ONLY, &workspace);
+                    });
+
+                    return GraphDataHandler(algorithm, time, density, representation, vertexCount, seed);
                 }
             }
         } catch (const std::exception& e) {
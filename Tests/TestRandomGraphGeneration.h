@@ -3,11 +3,12 @@
 #include <iostream>
 #include <memory>
 
+template<bool Directed>
 class TestRandomGraphGeneration
 {
     protected:
-    AdjacencyList listGraph;
-    AdjacencyMatrix matrixGraph;
+    AdjacencyList<Directed> listGraph;
+    AdjacencyMatrix<Directed> matrixGraph;
     bool graphLoaded = false;
 
 public:
@@ -19,20 +20,20 @@ public:
 
     void loadFromFile(const GraphProblemType type) {
         const auto graphData = FileReader::readGraphFromFile(type);
-        convertToRepresentations(graphData, true);
+        convertToRepresentations(graphData);
         displayBothRepresentations();
     }
 
-    void generateRandom(const int vertices, const int density, const bool isDirected) {
+    void generateRandom(const int vertices, const int density) {
         const auto generator = std::make_unique<RandomGraphGenerator>();
-        const auto graphData = generator->generate(vertices, density, isDirected);
-        convertToRepresentations(graphData, isDirected);
+        const auto graphData = generator->generate(vertices, density, Directed);
+        convertToRepresentations(graphData);
         displayBothRepresentations();
     }
 
-    void convertToRepresentations(const GraphData& data, const bool isDirected) {
-        listGraph = *GraphConverter::graphDataToAdjList(data, isDirected);
-        matrixGraph = *GraphConverter::graphDataToAdjMatrix(data, isDirected);
+    void convertToRepresentations(const GraphData& data) {
+        listGraph = GraphConverter::graphDataToAdjList<Directed>(data);
+        matrixGraph = GraphConverter::graphDataToAdjMatrix<Directed>(data);
         graphLoaded = true;
     }
 
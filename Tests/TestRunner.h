@@ -11,17 +11,23 @@
 class TestRunner
 {
 public:
+    static constexpr uint64_t DEFAULT_SEED = 1;
+
     /**
      * Run comprehensive performance tests for all algorithms and generate chart data
      * @param generationCount Number of test runs per configuration (for averaging)
+     * @param seed Seed every measured graph is derived from - the same seed measures the same graphs
+     * @param family Kind of graphs measured - results of families other than uniform go to their own subdirectory
      */
-    static void Run(int generationCount = 10)
+    static void Run(int generationCount = 10, uint64_t seed = DEFAULT_SEED, GraphFamily family = GraphFamily::UNIFORM)
     {
         std::cout << "=== Starting Performance Tests ===" << std::endl;
-        std::cout << "Generation count per test: " << generationCount << std::endl << std::endl;
+        std::cout << "Generation count per test: " << generationCount << std::endl;
+        std::cout << "Graph family: " << RandomGraphGenerator::familyName(family) << std::endl;
+        std::cout << "Seed: " << seed << std::endl << std::endl;
 
         // Test configuration
-        std::vector<int> densities = {20, 60, 99};
+        std::vector<int> densities = getDensitiesForFamily(family);
         std::vector<int> vertexCounts = {100, 250, 300, 400, 500, 600, 800};
         
         // Collect all data
@@ -30,7 +36,7 @@ public:
         std::cout << "Running tests for " << vertexCounts.size() << " vertex counts and " 
                   << densities.size() << " densities..." << std::endl;
         
-        int totalTests = vertexCounts.size() * densities.size() * 12; // 12 = 6 algorithms * 2 representations
+        int totalTests = vertexCounts.size() * densities.size() * 16; // 16 = 8 algorithms * 2 representations
         int currentTest = 0;
         
         for (const int vertexCount : vertexCounts)
@@ -40,32 +46,37 @@ public:
                 std::cout << "\n--- Testing: " << vertexCount << " vertices, " << density << "% density ---" << std::endl;
                 
                 // Test all algorithm-representation combinations
-                runAlgorithmTests(allData, generationCount, vertexCount, density, currentTest, totalTests);
+                runAlgorithmTests(allData, generationCount, vertexCount, density, seed, family, currentTest, totalTests);
             }
         }
         
         std::cout << "\n=== Tests Complete. Generating Files ===" << std::endl;
         
         // Create output directory
-        std::filesystem::create_directories("../Results");
+        const std::string directory = getResultsDirectory(family);
+        std::filesystem::create_directories(directory);
         
         // Write chart data files
-        writeChartFiles(allData);
+        writeChartFiles(allData, directory);
         
         std::cout << "\n=== All Done! ===" << std::endl;
         std::cout << "Generated " << allData.size() << " data points." << std::endl;
-        std::cout << "Files saved to ../Results/ directory." << std::endl;
+        std::cout << "Files saved to " << directory << "/ directory." << std::endl;
         std::cout << "Run Python scripts to generate charts." << std::endl;
+        printCacheStatistics();
     }
 
     /**
      * Run tests for specific problem type only
      */
-    static void RunForProblemType(GraphProblemType problemType, int generationCount = 10)
+    static void RunForProblemType(GraphProblemType problemType, int generationCount = 10, uint64_t seed = DEFAULT_SEED,
+                                  GraphFamily family = GraphFamily::UNIFORM)
     {
         std::cout << "=== Starting Tests for " << getProblemTypeName(problemType) << " ===" << std::endl;
+        std::cout << "Graph family: " << RandomGraphGenerator::familyName(family) << std::endl;
+        std::cout << "Seed: " << seed << std::endl;
         
-        std::vector<int> densities = {20, 60, 99};
+        std::vector<int> densities = getDensitiesForFamily(family);
         std::vector<int> vertexCounts = {100, 250, 300, 400, 500, 600, 800};
         std::vector<GraphDataHandler> data;
         
@@ -80,37 +91,50 @@ public:
             {
                 for (const auto& algorithm : algorithms)
                 {
-                    runSingleAlgorithmTest(data, algorithm, generationCount, vertexCount, density, currentTest, totalTests);
+                    runSingleAlgorithmTest(data, algorithm, generationCount, vertexCount, density, seed, family, currentTest, totalTests);
                 }
             }
         }
         
-        std::filesystem::create_directories("../Results");
-        writeChartFilesForProblemType(data, problemType);
+        const std::string directory = getResultsDirectory(family);
+        std::filesystem::create_directories(directory);
+        writeChartFilesForProblemType(data, problemType, directory);
         
         std::cout << "\n=== Done! ===" << std::endl;
+        printCacheStatistics();
     }
 
 private:
+    static void printCacheStatistics()
+    {
+        const auto& cache = ReportGenerator::Cache();
+        std::cout << "Graphs generated: " << cache.getGeneratedCount()
+                  << ", loaded from ../GraphCache: " << cache.getDiskHits()
+                  << ", reused from memory: " << cache.getMemoryHits() << std::endl;
+    }
+
     static void runAlgorithmTests(std::vector<GraphDataHandler>& allData, int generationCount, 
-                                 int vertexCount, int density, int& currentTest, int totalTests)
+                                 int vertexCount, int density, uint64_t seed, GraphFamily family,
+                                 int& currentTest, int totalTests)
     {
         // MST Algorithms
-        runSingleAlgorithmTest(allData, Algorithm::KRUSKAL, generationCount, vertexCount, density, currentTest, totalTests);
-        runSingleAlgorithmTest(allData, Algorithm::PRIM, generationCount, vertexCount, density, currentTest, totalTests);
+        runSingleAlgorithmTest(allData, Algorithm::KRUSKAL, generationCount, vertexCount, density, seed, family, currentTest, totalTests);
+        runSingleAlgorithmTest(allData, Algorithm::PRIM, generationCount, vertexCount, density, seed, family, currentTest, totalTests);
         
         // Shortest Path Algorithms
-        runSingleAlgorithmTest(allData, Algorithm::DIJKSTRA, generationCount, vertexCount, density, currentTest, totalTests);
-        runSingleAlgorithmTest(allData, Algorithm::BELLMAN_FORD, generationCount, vertexCount, density, currentTest, totalTests);
+        runSingleAlgorithmTest(allData, Algorithm::DIJKSTRA, generationCount, vertexCount, density, seed, family, currentTest, totalTests);
+        runSingleAlgorithmTest(allData, Algorithm::BELLMAN_FORD, generationCount, vertexCount, density, seed, family, currentTest, totalTests);
         
         // Max Flow Algorithms
-        runSingleAlgorithmTest(allData, Algorithm::FORD_FULKERSON_DFS, generationCount, vertexCount, density, currentTest, totalTests);
-        runSingleAlgorithmTest(allData, Algorithm::FORD_FULKERSON_BFS, generationCount, vertexCount, density, currentTest, totalTests);
+        runSingleAlgorithmTest(allData, Algorithm::FORD_FULKERSON_DFS, generationCount, vertexCount, density, seed, family, currentTest, totalTests);
+        runSingleAlgorithmTest(allData, Algorithm::FORD_FULKERSON_BFS, generationCount, vertexCount, density, seed, family, currentTest, totalTests);
+        runSingleAlgorithmTest(allData, Algorithm::FORD_FULKERSON_DOBFS, generationCount, vertexCount, density, seed, family, currentTest, totalTests);
+        runSingleAlgorithmTest(allData, Algorithm::FORD_FULKERSON_SCALING, generationCount, vertexCount, density, seed, family, currentTest, totalTests);
     }
     
     static void runSingleAlgorithmTest(std::vector<GraphDataHandler>& data, Algorithm algorithm, 
-                                      int generationCount, int vertexCount, int density, 
-                                      int& currentTest, int totalTests)
+                                      int generationCount, int vertexCount, int density, uint64_t seed,
+                                      GraphFamily family, int& currentTest, int totalTests)
     {
         // Test both representations
         for (const auto& representation : {GraphRepresentationType::ADJACENCY_LIST, GraphRepresentationType::ADJACENCY_MATRIX})
@@ -120,35 +144,55 @@ private:
             std::cout << "[" << std::setw(3) << currentTest << "/" << totalTests << "] " 
                       << getAlgorithmName(algorithm) << " (" << getRepresentationName(representation) << ")... ";
             
-            auto results = ReportGenerator::GenerateType1Report(algorithm, density, generationCount, vertexCount, representation);
+            auto results = ReportGenerator::GenerateType1Report(algorithm, density, generationCount, vertexCount, representation, seed, family);
             data.insert(data.end(), results.begin(), results.end());
             
             std::cout << "Done" << std::endl;
         }
     }
     
-    static void writeChartFiles(const std::vector<GraphDataHandler>& data)
+    static void writeChartFiles(const std::vector<GraphDataHandler>& data, const std::string& directory)
     {
         std::cout << "\nWriting Type 1 chart files..." << std::endl;
-        FileWriter::writeType1ChartData(data, GraphProblemType::MST, "../Results/MST");
-        FileWriter::writeType1ChartData(data, GraphProblemType::SHORTEST_PATH, "../Results/SHORTEST_PATH");
-        FileWriter::writeType1ChartData(data, GraphProblemType::MAX_FLOW, "../Results/MAX_FLOW");
+        FileWriter::writeType1ChartData(data, GraphProblemType::MST, directory + "/MST");
+        FileWriter::writeType1ChartData(data, GraphProblemType::SHORTEST_PATH, directory + "/SHORTEST_PATH");
+        FileWriter::writeType1ChartData(data, GraphProblemType::MAX_FLOW, directory + "/MAX_FLOW");
         
         std::cout << "Writing Type 2 chart files..." << std::endl;
-        FileWriter::writeType2ChartData(data, GraphProblemType::MST, "../Results/MST");
-        FileWriter::writeType2ChartData(data, GraphProblemType::SHORTEST_PATH, "../Results/SHORTEST_PATH");
-        FileWriter::writeType2ChartData(data, GraphProblemType::MAX_FLOW, "../Results/MAX_FLOW");
+        FileWriter::writeType2ChartData(data, GraphProblemType::MST, directory + "/MST");
+        FileWriter::writeType2ChartData(data, GraphProblemType::SHORTEST_PATH, directory + "/SHORTEST_PATH");
+        FileWriter::writeType2ChartData(data, GraphProblemType::MAX_FLOW, directory + "/MAX_FLOW");
     }
     
-    static void writeChartFilesForProblemType(const std::vector<GraphDataHandler>& data, GraphProblemType problemType)
+    static void writeChartFilesForProblemType(const std::vector<GraphDataHandler>& data, GraphProblemType problemType,
+                                              const std::string& directory)
     {
-        std::string baseName = "../Results/" + getProblemTypeName(problemType);
+        std::string baseName = directory + "/" + getProblemTypeName(problemType);
         
         std::cout << "Writing chart files for " << getProblemTypeName(problemType) << "..." << std::endl;
         FileWriter::writeType1ChartData(data, problemType, baseName);
         FileWriter::writeType2ChartData(data, problemType, baseName);
     }
     
+    // Lattices have a single density per size, so they are measured once and filed under density 0
+    static std::vector<int> getDensitiesForFamily(GraphFamily family)
+    {
+        switch (family) {
+            case GraphFamily::GRID_2D:
+            case GraphFamily::GRID_3D:
+                return {0};
+            default:
+                return {20, 60, 99};
+        }
+    }
+
+    // Uniform results stay where the chart scripts read them, other families get a subdirectory each
+    static std::string getResultsDirectory(GraphFamily family)
+    {
+        if (family == GraphFamily::UNIFORM) return "../Results";
+        return "../Results/" + RandomGraphGenerator::familyName(family);
+    }
+
     static std::vector<Algorithm> getAlgorithmsForProblemType(GraphProblemType problemType)
     {
         switch (problemType) {
@@ -157,7 +201,7 @@ private:
             case GraphProblemType::SHORTEST_PATH:
                 return {Algorithm::DIJKSTRA, Algorithm::BELLMAN_FORD};
             case GraphProblemType::MAX_FLOW:
-                return {Algorithm::FORD_FULKERSON_DFS, Algorithm::FORD_FULKERSON_BFS};
+                return {Algorithm::FORD_FULKERSON_DFS, Algorithm::FORD_FULKERSON_BFS, Algorithm::FORD_FULKERSON_DOBFS, Algorithm::FORD_FULKERSON_SCALING};
             default:
                 return {};
         }
@@ -182,6 +226,8 @@ private:
             case Algorithm::BELLMAN_FORD: return "Bellman-Ford";
             case Algorithm::FORD_FULKERSON_DFS: return "Ford-Fulkerson (DFS)";
             case Algorithm::FORD_FULKERSON_BFS: return "Ford-Fulkerson (BFS)";
+            case Algorithm::FORD_FULKERSON_DOBFS: return "Ford-Fulkerson (DO-BFS)";
+            case Algorithm::FORD_FULKERSON_SCALING: return "Ford-Fulkerson (capacity scaling)";
             default: return "Unknown";
         }
     }
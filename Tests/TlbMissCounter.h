@@ -0,0 +1,66 @@
+#ifndef TLBMISSCOUNTER_H
+#define TLBMISSCOUNTER_H
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Counts data-TLB load misses of the calling thread through perf_event_open (Linux only)
+class TlbMissCounter {
+private:
+    int fd;
+
+public:
+    TlbMissCounter() : fd(-1) {
+#if defined(__linux__)
+        perf_event_attr attributes{};
+        attributes.type = PERF_TYPE_HW_CACHE;
+        attributes.size = sizeof(attributes);
+        attributes.config = PERF_COUNT_HW_CACHE_DTLB
+                          | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                          | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        fd = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+#endif
+    }
+
+    ~TlbMissCounter() {
+#if defined(__linux__)
+        if (fd != -1) close(fd);
+#endif
+    }
+
+    TlbMissCounter(const TlbMissCounter&) = delete;
+    TlbMissCounter& operator=(const TlbMissCounter&) = delete;
+
+    // False when the platform, the CPU or perf_event_paranoid does not allow counting
+    [[nodiscard]] bool available() const { return fd != -1; }
+
+    void start() {
+#if defined(__linux__)
+        if (fd == -1) return;
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    // Misses since start(), -1 when counting is unavailable
+    long long stop() {
+#if defined(__linux__)
+        if (fd == -1) return -1;
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        long long count = 0;
+        if (read(fd, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) return -1;
+        return count;
+#else
+        return -1;
+#endif
+    }
+};
+
+#endif //TLBMISSCOUNTER_H
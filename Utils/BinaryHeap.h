@@ -2,6 +2,7 @@
 #define BINARYHEAP_H
 
 #include "DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "Memory/AlgorithmWorkspace.h"
 
 template<typename T>
 class BinaryHeap {
@@ -19,8 +20,8 @@ private:
         }
     };
 
-    DefinitelyNotAVector<HeapNode> heap;
-    DefinitelyNotAVector<int> position; // Maps vertex to its position in heap
+    ScratchVector<HeapNode> heap;
+    ScratchVector<int> position; // Maps vertex to its position in heap
 
     void swap(int i, int j) {
         HeapNode temp = heap[i];
@@ -61,7 +62,11 @@ private:
     }
 
 public:
-    explicit BinaryHeap(int capacity) : position(capacity, -1) {}
+    // Room for every vertex is reserved up front, inside the workspace when one is given
+    explicit BinaryHeap(int capacity, AlgorithmWorkspace* workspace = nullptr)
+        : heap(WorkspaceAllocator<HeapNode>(workspace)), position(capacity, -1, WorkspaceAllocator<int>(workspace)) {
+        heap.reserve(capacity);
+    }
 
     void insert(T value, int vertex, int key) {
         heap.push_back(HeapNode(value, vertex, key));
@@ -1,17 +1,18 @@
 #ifndef TYPE1GRAPHDATAHANDLER_H
 #define TYPE1GRAPHDATAHANDLER_H
 
+#include <cstdint>
 #include "../Enums/Algorithm.h"
 #include "../Enums/GraphRepresentationType.h"
 
 struct GraphDataHandler
 {
-    GraphDataHandler() : algorithm(), MeasuredTime(0), representation(), Density(0), VertexCount(0)
+    GraphDataHandler() : algorithm(), MeasuredTime(0), representation(), Density(0), VertexCount(0), Seed(0)
     {
     }
 
-    GraphDataHandler(const Algorithm algorithm, const double measuredTime, const int density, const GraphRepresentationType representation, const int vertexCount)
-        : algorithm(algorithm), MeasuredTime(measuredTime), representation(representation), Density(density), VertexCount(vertexCount)
+    GraphDataHandler(const Algorithm algorithm, const double measuredTime, const int density, const GraphRepresentationType representation, const int vertexCount, const uint64_t seed)
+        : algorithm(algorithm), MeasuredTime(measuredTime), representation(representation), Density(density), VertexCount(vertexCount), Seed(seed)
     {
     }
 
@@ -20,6 +21,7 @@ struct GraphDataHandler
     GraphRepresentationType representation;
     int Density;
     int VertexCount;
+    uint64_t Seed; // benchmark seed the measured graphs were generated from
 };
 
 #endif //TYPE1GRAPHDATAHANDLER_H
\ No newline at end of file
@@ -0,0 +1,61 @@
+#ifndef DEFINITELYNOTABITSET_H
+#define DEFINITELYNOTABITSET_H
+
+#include <bit>
+#include <cstdint>
+#include "DefinitelyNotAVector.h"
+
+// Fixed-size bitset backed by 64-bit words, one bit per vertex
+class DefinitelyNotABitset {
+private:
+    DefinitelyNotAVector<uint64_t> words;
+    size_t bits;
+
+public:
+    DefinitelyNotABitset() : bits(0) {}
+
+    explicit DefinitelyNotABitset(size_t count)
+        : words((count + 63) / 64, 0), bits(count) {}
+
+    void set(size_t index) {
+        words[index >> 6] |= uint64_t(1) << (index & 63);
+    }
+
+    void reset(size_t index) {
+        words[index >> 6] &= ~(uint64_t(1) << (index & 63));
+    }
+
+    [[nodiscard]] bool test(size_t index) const {
+        return (words[index >> 6] >> (index & 63)) & 1;
+    }
+
+    void clear() {
+        for (auto& word : words) {
+            word = 0;
+        }
+    }
+
+    [[nodiscard]] size_t count() const {
+        size_t total = 0;
+        for (const auto word : words) {
+            total += std::popcount(word);
+        }
+        return total;
+    }
+
+    [[nodiscard]] bool none() const {
+        for (const auto word : words) {
+            if (word != 0) return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] size_t size() const { return bits; }
+    [[nodiscard]] size_t wordCount() const { return words.size(); }
+
+    // Raw word access for word-at-a-time scans
+    uint64_t& word(size_t index) { return words[index]; }
+    [[nodiscard]] uint64_t word(size_t index) const { return words[index]; }
+};
+
+#endif //DEFINITELYNOTABITSET_H
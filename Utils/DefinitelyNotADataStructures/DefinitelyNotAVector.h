@@ -1,144 +1,286 @@
 #ifndef GIGAKOMARVECTOR_H
 #define GIGAKOMARVECTOR_H
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
-template<class T>
+/**
+ * Growable array over raw, uninitialized storage.
+ * Only slots [0, size) hold constructed objects, growth relocates with memcpy when T is trivially copyable
+ * (int, Edge, bitset words) and by move-construct + destroy otherwise.
+ * operator[] is bounds-checked in debug builds only, at() always checks.
+ * Storage comes from Allocator, so scratch arrays can live in an AlgorithmWorkspace arena.
+ */
+template<class T, class Allocator = std::allocator<T>>
 class DefinitelyNotAVector {
 private:
-    T* data;
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+    T* buffer;
     size_t size_;
     size_t capacity_;
+    [[no_unique_address]] Allocator allocator;
 
-public:
-    DefinitelyNotAVector() : data(nullptr), size_(0), capacity_(0) {}
+    T* allocate(size_t count) {
+        return count == 0 ? nullptr : AllocatorTraits::allocate(allocator, count);
+    }
 
-    // Constructor with size and default value
-    DefinitelyNotAVector(size_t count, const T& value) 
-        : data(new T[count]), size_(count), capacity_(count) {
-        for (size_t i = 0; i < count; i++) {
-            data[i] = value;
+    void deallocate(T* pointer, size_t count) {
+        if (pointer != nullptr) {
+            AllocatorTraits::deallocate(allocator, pointer, count);
         }
     }
 
-    // Constructor with just size (default-initializes elements)
-    explicit DefinitelyNotAVector(size_t count)
-        : data(new T[count]), size_(count), capacity_(count) {
-        for (size_t i = 0; i < count; i++) {
-            data[i] = T();
+    // Moves count constructed objects from source into uninitialized destination, leaving source uninitialized
+    static void relocate(T* source, size_t count, T* destination) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (count > 0) {
+                std::memcpy(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+            }
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                std::construct_at(destination + i, std::move(source[i]));
+                std::destroy_at(source + i);
+            }
         }
     }
 
+    void destroyAll() {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            std::destroy_n(buffer, size_);
+        }
+        size_ = 0;
+    }
+
+    void reallocate(size_t newCapacity) {
+        T* newBuffer = allocate(newCapacity);
+        relocate(buffer, size_, newBuffer);
+        deallocate(buffer, capacity_);
+        buffer = newBuffer;
+        capacity_ = newCapacity;
+    }
+
+    [[nodiscard]] size_t grownCapacity() const {
+        return capacity_ == 0 ? 1 : capacity_ * 2;
+    }
+
+public:
+    DefinitelyNotAVector() : buffer(nullptr), size_(0), capacity_(0), allocator() {}
+
+    explicit DefinitelyNotAVector(const Allocator& allocator)
+        : buffer(nullptr), size_(0), capacity_(0), allocator(allocator) {}
+
+    // Constructor with size and default value
+    DefinitelyNotAVector(size_t count, const T& value, const Allocator& allocator = Allocator())
+        : buffer(nullptr), size_(count), capacity_(count), allocator(allocator) {
+        buffer = allocate(count);
+        std::uninitialized_fill_n(buffer, count, value);
+    }
+
+    // Constructor with just size (value-initializes elements, so numbers start at zero)
+    explicit DefinitelyNotAVector(size_t count, const Allocator& allocator = Allocator())
+        : buffer(nullptr), size_(count), capacity_(count), allocator(allocator) {
+        buffer = allocate(count);
+        std::uninitialized_value_construct_n(buffer, count);
+    }
+
     ~DefinitelyNotAVector() {
-        delete[] data;
+        destroyAll();
+        deallocate(buffer, capacity_);
     }
 
-    // Copy constructor
+    // Copy constructor - the copy is allocated to its size, not to the capacity of other
     DefinitelyNotAVector(const DefinitelyNotAVector& other)
-        : data(new T[other.capacity_]), size_(other.size_), capacity_(other.capacity_) {
-        for (size_t i = 0; i < size_; i++) {
-            data[i] = other.data[i];
-        }
+        : buffer(nullptr), size_(other.size_), capacity_(other.size_),
+          allocator(AllocatorTraits::select_on_container_copy_construction(other.allocator)) {
+        buffer = allocate(other.size_);
+        std::uninitialized_copy_n(other.buffer, other.size_, buffer);
     }
 
     // Move constructor
     DefinitelyNotAVector(DefinitelyNotAVector&& other) noexcept
-        : data(other.data), size_(other.size_), capacity_(other.capacity_) {
-        other.data = nullptr;
+        : buffer(other.buffer), size_(other.size_), capacity_(other.capacity_), allocator(std::move(other.allocator)) {
+        other.buffer = nullptr;
         other.size_ = 0;
         other.capacity_ = 0;
     }
 
-    // Copy assignment
+    // Copy assignment - reuses the current storage when it is large enough
     DefinitelyNotAVector& operator=(const DefinitelyNotAVector& other) {
         if (this != &other) {
-            delete[] data;
-            data = new T[other.capacity_];
-            size_ = other.size_;
-            capacity_ = other.capacity_;
-            for (size_t i = 0; i < size_; i++) {
-                data[i] = other.data[i];
+            destroyAll();
+            if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value) {
+                if (allocator != other.allocator) {
+                    deallocate(buffer, capacity_);
+                    buffer = nullptr;
+                    capacity_ = 0;
+                }
+                allocator = other.allocator;
+            }
+            if (capacity_ < other.size_) {
+                deallocate(buffer, capacity_);
+                buffer = allocate(other.size_);
+                capacity_ = other.size_;
             }
+            std::uninitialized_copy_n(other.buffer, other.size_, buffer);
+            size_ = other.size_;
         }
         return *this;
     }
 
-    // Move assignment
-    DefinitelyNotAVector& operator=(DefinitelyNotAVector&& other) noexcept {
-        if (this != &other) {
-            delete[] data;
-            data = other.data;
+    // Move assignment - steals the buffer unless it belongs to an allocator this vector cannot free into
+    DefinitelyNotAVector& operator=(DefinitelyNotAVector&& other)
+        noexcept(AllocatorTraits::propagate_on_container_move_assignment::value || AllocatorTraits::is_always_equal::value) {
+        if (this == &other) {
+            return *this;
+        }
+
+        destroyAll();
+        if (AllocatorTraits::propagate_on_container_move_assignment::value || allocator == other.allocator) {
+            deallocate(buffer, capacity_);
+            if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+                allocator = std::move(other.allocator);
+            }
+            buffer = other.buffer;
             size_ = other.size_;
             capacity_ = other.capacity_;
-            other.data = nullptr;
+            other.buffer = nullptr;
             other.size_ = 0;
             other.capacity_ = 0;
+        } else {
+            reserve(other.size_);
+            std::uninitialized_move_n(other.buffer, other.size_, buffer);
+            size_ = other.size_;
+            other.clear();
         }
         return *this;
     }
 
+    [[nodiscard]] Allocator get_allocator() const { return allocator; }
+
     void push_back(const T& value) {
-        if (size_ == capacity_) {
-            resize(capacity_ == 0 ? 1 : capacity_ * 2);
-        }
-        data[size_++] = value;
+        emplace_back(value);
     }
 
     void push_back(T&& value) {
-        if (size_ == capacity_) {
-            resize(capacity_ == 0 ? 1 : capacity_ * 2);
-        }
-        data[size_++] = std::move(value);
+        emplace_back(std::move(value));
     }
 
     template<typename... Args>
-    void emplace_back(Args&&... args) {
+    T& emplace_back(Args&&... args) {
         if (size_ == capacity_) {
-            resize(capacity_ == 0 ? 1 : capacity_ * 2);
+            // The new element is built before the old ones move, so args may refer into this vector
+            const size_t newCapacity = grownCapacity();
+            T* newBuffer = allocate(newCapacity);
+            try {
+                std::construct_at(newBuffer + size_, std::forward<Args>(args)...);
+            } catch (...) {
+                // Nothing was moved yet, so the vector is left exactly as it was
+                deallocate(newBuffer, newCapacity);
+                throw;
+            }
+            relocate(buffer, size_, newBuffer);
+            deallocate(buffer, capacity_);
+            buffer = newBuffer;
+            capacity_ = newCapacity;
+        } else {
+            std::construct_at(buffer + size_, std::forward<Args>(args)...);
         }
-        new (&data[size_]) T(std::forward<Args>(args)...);
-        size_++;
+        return buffer[size_++];
     }
 
     T& operator[](size_t index) {
+#ifndef NDEBUG
         if (index >= size_) {
             throw std::out_of_range("Index out of range");
         }
-        return data[index];
+#endif
+        return buffer[index];
     }
 
     const T& operator[](size_t index) const {
+#ifndef NDEBUG
         if (index >= size_) {
             throw std::out_of_range("Index out of range");
         }
-        return data[index];
+#endif
+        return buffer[index];
     }
 
+    // Checked in every build
+    T& at(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return buffer[index];
+    }
+
+    const T& at(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return buffer[index];
+    }
+
+    T& back() { return (*this)[size_ - 1]; }
+    const T& back() const { return (*this)[size_ - 1]; }
+
     [[nodiscard]] size_t size() const { return size_; }
+    [[nodiscard]] size_t capacity() const { return capacity_; }
     [[nodiscard]] bool empty() const { return size_ == 0; }
 
-    void resize(const size_t new_capacity) {
-        T* new_data = new T[new_capacity];
-        for (size_t i = 0; i < size_; i++) {
-            new_data[i] = std::move(data[i]);
+    T* data() { return buffer; }
+    const T* data() const { return buffer; }
+
+    // Allocates room for at least newCapacity elements without constructing any
+    void reserve(const size_t newCapacity) {
+        if (newCapacity > capacity_) {
+            reallocate(newCapacity);
+        }
+    }
+
+    void shrink_to_fit() {
+        if (capacity_ > size_) {
+            reallocate(size_);
         }
-        delete[] data;
-        data = new_data;
-        capacity_ = new_capacity;
+    }
+
+    // New elements are value-initialized
+    void resize(const size_t newSize) {
+        if (newSize < size_) {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                std::destroy(buffer + newSize, buffer + size_);
+            }
+        } else if (newSize > size_) {
+            if (newSize > capacity_) {
+                reallocate(std::max(newSize, grownCapacity()));
+            }
+            std::uninitialized_value_construct(buffer + size_, buffer + newSize);
+        }
+        size_ = newSize;
+    }
+
+    void clear() {
+        destroyAll();
     }
 
     void pop_back() {
         if (size_ > 0) {
             --size_;
+            std::destroy_at(buffer + size_);
         }
     }
 
 
     // Iterator support
-    T* begin() { return data; }
-    T* end() { return data + size_; }
-    const T* begin() const { return data; }
-    const T* end() const { return data + size_; }
+    T* begin() { return buffer; }
+    T* end() { return buffer + size_; }
+    const T* begin() const { return buffer; }
+    const T* end() const { return buffer + size_; }
 };
 
-#endif //GIGAKOMARVECTOR_H
\ No newline at end of file
+#endif //GIGAKOMARVECTOR_H
@@ -2,15 +2,17 @@
 #define UNIONFIND_H
 
 #include "DefinitelyNotAVector.h"
+#include "../Memory/AlgorithmWorkspace.h"
 
 class UnionFind {
 private:
-    DefinitelyNotAVector<int> parent;
-    DefinitelyNotAVector<int> rank;
+    ScratchVector<int> parent;
+    ScratchVector<int> rank;
     int count; // Number of disjoint sets
 
 public:
-    explicit UnionFind(int size) : parent(size), rank(size, 0), count(size) {
+    explicit UnionFind(int size, AlgorithmWorkspace* workspace = nullptr)
+        : parent(size, WorkspaceAllocator<int>(workspace)), rank(size, 0, WorkspaceAllocator<int>(workspace)), count(size) {
         // Initialize each element as its own set
         for (int i = 0; i < size; i++) {
             parent[i] = i;
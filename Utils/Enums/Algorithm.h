@@ -9,6 +9,8 @@ enum class Algorithm
     DIJKSTRA,
     FORD_FULKERSON_DFS,
     FORD_FULKERSON_BFS,
+    FORD_FULKERSON_DOBFS,
+    FORD_FULKERSON_SCALING,
 };
 
 #endif //ALGORITHM_H
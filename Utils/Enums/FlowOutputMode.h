@@ -0,0 +1,11 @@
+#ifndef FLOWOUTPUTMODE_H
+#define FLOWOUTPUTMODE_H
+
+enum class FlowOutputMode {
+    VALUE_ONLY, // maxFlow only
+    CUT_ONLY,   // maxFlow and the source side of the min cut
+    SPARSE,     // maxFlow, min cut and one flow value per input edge
+    DENSE       // everything, including the V x V residual and flow matrices
+};
+
+#endif //FLOWOUTPUTMODE_H
@@ -0,0 +1,13 @@
+#ifndef GRAPHFAMILY_H
+#define GRAPHFAMILY_H
+
+enum class GraphFamily {
+    UNIFORM,   // every candidate edge equally likely, kept connected by a random spanning path or cycle
+    RMAT,      // Graph500 R-MAT / Kronecker, skewed power-law degrees
+    GRID_2D,   // square lattice with perturbed weights, road-like
+    GRID_3D,   // cubic lattice with perturbed weights
+    POWER_LAW, // Barabasi-Albert preferential attachment
+    GEOMETRIC  // random points in the unit square, joined when close, weighted by distance
+};
+
+#endif //GRAPHFAMILY_H
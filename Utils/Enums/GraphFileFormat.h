@@ -0,0 +1,13 @@
+#ifndef GRAPHFILEFORMAT_H
+#define GRAPHFILEFORMAT_H
+
+enum class GraphFileFormat {
+    NATIVE,        // "E V [start [end]]" header, then "u v w" lines
+    SNAPSHOT,      // binary CSR snapshot
+    DIMACS,        // .gr shortest path, .max max flow (1-based "a u v w" arcs)
+    METIS,         // .graph adjacency lines (1-based, undirected)
+    MATRIX_MARKET, // .mtx coordinate matrices (1-based)
+    SNAP           // whitespace separated "u v" edge lists with '#' comments
+};
+
+#endif //GRAPHFILEFORMAT_H
@@ -0,0 +1,9 @@
+#ifndef MEMORYPOLICY_H
+#define MEMORYPOLICY_H
+
+enum class MemoryPolicy {
+    STANDARD,   // regular heap allocation
+    HUGE_PAGES  // buffers of at least one huge page are mapped separately and advised to use transparent huge pages
+};
+
+#endif //MEMORYPOLICY_H
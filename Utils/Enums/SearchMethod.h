@@ -3,7 +3,9 @@
 
 enum class SearchMethod {
     BFS,
-    DFS
+    DFS,
+    DIRECTION_OPTIMIZING_BFS,
+    CAPACITY_SCALING
 };
 
 #endif //SEARCHMETHOD_H
@@ -1,15 +1,78 @@
 #ifndef GRAPHDATA_H
 #define GRAPHDATA_H
 
-#include "DefinitelyNotADataStructures/DefinitelyNotATuple.h"
+#include <cstdint>
 #include "DefinitelyNotADataStructures/DefinitelyNotAVector.h"
 
-struct GraphData {
-    int numEdges;
-    int numVertices;
-    int startVertex;
-    int endVertex;
-    DefinitelyNotAVector<DefinitelyNotATuple<int, int, int>> edges; // <start_vertex, end_vertex, weight/capacity>
+/**
+ * Columnar edge storage - one array per field, so a pass that needs only weights (or only endpoints)
+ * reads only that array, and the arrays grow without building any per-edge objects.
+ */
+template<typename Weight>
+class EdgeStore {
+private:
+    DefinitelyNotAVector<int> sources;
+    DefinitelyNotAVector<int> destinations;
+    DefinitelyNotAVector<Weight> weights;
+
+public:
+    void reserve(const size_t count) {
+        sources.reserve(count);
+        destinations.reserve(count);
+        weights.reserve(count);
+    }
+
+    void add(const int source, const int destination, const Weight weight) {
+        sources.push_back(source);
+        destinations.push_back(destination);
+        weights.push_back(weight);
+    }
+
+    // Makes room for count edges that are then filled with set() - lets parallel loaders write disjoint ranges
+    void resize(const size_t count) {
+        sources.resize(count);
+        destinations.resize(count);
+        weights.resize(count);
+    }
+
+    void set(const size_t index, const int source, const int destination, const Weight weight) {
+        sources[index] = source;
+        destinations[index] = destination;
+        weights[index] = weight;
+    }
+
+    [[nodiscard]] int source(const size_t index) const { return sources[index]; }
+    [[nodiscard]] int destination(const size_t index) const { return destinations[index]; }
+    [[nodiscard]] Weight weight(const size_t index) const { return weights[index]; }
+
+    [[nodiscard]] const DefinitelyNotAVector<int>& getSources() const { return sources; }
+    [[nodiscard]] const DefinitelyNotAVector<int>& getDestinations() const { return destinations; }
+    [[nodiscard]] const DefinitelyNotAVector<Weight>& getWeights() const { return weights; }
+
+    [[nodiscard]] size_t size() const { return sources.size(); }
+    [[nodiscard]] bool empty() const { return sources.empty(); }
+
+    // Calls visit(source, destination, weight) for every stored edge
+    template<typename Visit>
+    void forEach(Visit&& visit) const {
+        for (size_t i = 0; i < sources.size(); i++) {
+            visit(sources[i], destinations[i], weights[i]);
+        }
+    }
 };
 
+template<typename Weight>
+struct WeightedGraphData {
+    // 64 bits, dense graphs of a few tens of thousands of vertices already hold more than 2^31 edges
+    int64_t numEdges = 0;
+    int numVertices = 0;
+    int startVertex = -1;
+    int endVertex = -1;
+    // Undirected edges are stored once and hold in both directions
+    bool isUndirected = false;
+    EdgeStore<Weight> edges; // <start_vertex, end_vertex, weight/capacity>
+};
+
+using GraphData = WeightedGraphData<int>;
+
 #endif //GRAPHDATA_H
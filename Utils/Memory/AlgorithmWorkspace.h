@@ -0,0 +1,155 @@
+#ifndef ALGORITHMWORKSPACE_H
+#define ALGORITHMWORKSPACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include "../DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "../Enums/MemoryPolicy.h"
+#include "GraphStorageAllocator.h"
+
+/**
+ * Monotonic arena for the scratch arrays of one algorithm run.
+ * Allocation bumps an offset inside the current block, freeing is a no-op and reset() rewinds to the first
+ * block in O(1) while keeping every block, so repeated runs of the same size stop touching the system allocator.
+ * Under MemoryPolicy::HUGE_PAGES blocks of at least 2 MiB are huge-page mappings (e.g. Ford-Fulkerson residual rows).
+ */
+class AlgorithmWorkspace {
+private:
+    struct Block {
+        std::byte* memory;
+        size_t size;
+    };
+
+    DefinitelyNotAVector<Block> blocks;
+    size_t current;
+    size_t offset;
+    size_t nextBlockSize;
+    MemoryPolicy memory;
+
+    [[nodiscard]] Block newBlock(size_t size) const {
+        if (HugePages::shouldMap(memory, size)) {
+            size = HugePages::mappedSize(size);
+            return Block{static_cast<std::byte*>(HugePages::map(size)), size};
+        }
+        return Block{static_cast<std::byte*>(::operator new(size)), size};
+    }
+
+    void freeBlock(const Block& block) const {
+        if (HugePages::shouldMap(memory, block.size)) {
+            HugePages::unmap(block.memory, block.size);
+        } else {
+            ::operator delete(block.memory);
+        }
+    }
+
+    // Aligns the absolute address, so alignments above the one of operator new work as well
+    [[nodiscard]] static size_t alignedOffset(const Block& block, size_t offset, size_t alignment) {
+        const auto base = reinterpret_cast<std::uintptr_t>(block.memory);
+        return ((base + offset + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1)) - base;
+    }
+
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = size_t(1) << 20;
+
+    explicit AlgorithmWorkspace(size_t initialBlockSize = DEFAULT_BLOCK_SIZE, MemoryPolicy memory = MemoryPolicy::STANDARD)
+        : current(0), offset(0), nextBlockSize(initialBlockSize), memory(memory) {}
+
+    ~AlgorithmWorkspace() {
+        release();
+    }
+
+    AlgorithmWorkspace(const AlgorithmWorkspace&) = delete;
+    AlgorithmWorkspace& operator=(const AlgorithmWorkspace&) = delete;
+
+    [[nodiscard]] void* allocate(size_t bytes, size_t alignment) {
+        while (current < blocks.size()) {
+            const size_t start = alignedOffset(blocks[current], offset, alignment);
+            if (start + bytes <= blocks[current].size) {
+                offset = start + bytes;
+                return blocks[current].memory + start;
+            }
+            current++;
+            offset = 0;
+        }
+
+        // Blocks double in size, so the number of blocks stays logarithmic in the peak usage
+        const size_t size = std::max(nextBlockSize, bytes + alignment);
+        blocks.push_back(newBlock(size));
+        nextBlockSize = blocks.back().size * 2;
+        current = blocks.size() - 1;
+
+        const size_t start = alignedOffset(blocks[current], 0, alignment);
+        offset = start + bytes;
+        return blocks[current].memory + start;
+    }
+
+    // Invalidates everything allocated so far, keeps the memory for the next run
+    void reset() {
+        current = 0;
+        offset = 0;
+    }
+
+    // Returns all blocks to the system
+    void release() {
+        for (const auto& block : blocks) {
+            freeBlock(block);
+        }
+        blocks.clear();
+        reset();
+    }
+
+    [[nodiscard]] size_t bytesReserved() const {
+        size_t total = 0;
+        for (const auto& block : blocks) {
+            total += block.size;
+        }
+        return total;
+    }
+};
+
+// Draws from a workspace, or from the heap when constructed without one
+template<typename T>
+class WorkspaceAllocator {
+private:
+    AlgorithmWorkspace* workspace;
+
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::false_type;
+
+    WorkspaceAllocator() noexcept : workspace(nullptr) {}
+    explicit WorkspaceAllocator(AlgorithmWorkspace* workspace) noexcept : workspace(workspace) {}
+
+    template<typename U>
+    WorkspaceAllocator(const WorkspaceAllocator<U>& other) noexcept : workspace(other.getWorkspace()) {}
+
+    [[nodiscard]] T* allocate(size_t count) {
+        if (workspace != nullptr) {
+            return static_cast<T*>(workspace->allocate(count * sizeof(T), alignof(T)));
+        }
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* pointer, size_t count) {
+        if (workspace == nullptr) {
+            std::allocator<T>().deallocate(pointer, count);
+        }
+    }
+
+    [[nodiscard]] AlgorithmWorkspace* getWorkspace() const { return workspace; }
+
+    template<typename U>
+    bool operator==(const WorkspaceAllocator<U>& other) const {
+        return workspace == other.getWorkspace();
+    }
+};
+
+// Scratch array of an algorithm run - lives in the workspace passed to the algorithm, if any
+template<typename T>
+using ScratchVector = DefinitelyNotAVector<T, WorkspaceAllocator<T>>;
+
+#endif //ALGORITHMWORKSPACE_H
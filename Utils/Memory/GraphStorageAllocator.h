@@ -0,0 +1,118 @@
+#ifndef GRAPHSTORAGEALLOCATOR_H
+#define GRAPHSTORAGEALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include "../Enums/MemoryPolicy.h"
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define GRAPH_STORAGE_HAS_MMAP 1
+#endif
+
+// Anonymous mappings aligned to the 2 MiB huge page size, so the kernel can back them with huge pages
+class HugePages {
+public:
+    static constexpr size_t PAGE_SIZE = size_t(2) << 20;
+
+    // Whether a buffer of this size under this policy goes through map() - deallocation repeats the decision
+    [[nodiscard]] static bool shouldMap(const MemoryPolicy policy, const size_t bytes) {
+#ifdef GRAPH_STORAGE_HAS_MMAP
+        return policy == MemoryPolicy::HUGE_PAGES && bytes >= PAGE_SIZE;
+#else
+        (void)policy;
+        (void)bytes;
+        return false;
+#endif
+    }
+
+    [[nodiscard]] static size_t mappedSize(const size_t bytes) {
+        return (bytes + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+    }
+
+    // When the kernel refuses huge pages the mapping still works with regular pages
+    [[nodiscard]] static void* map(const size_t bytes) {
+#ifdef GRAPH_STORAGE_HAS_MMAP
+        const size_t size = mappedSize(bytes);
+
+        // Over-map by one huge page and trim both ends to get a 2 MiB aligned range
+        void* raw = mmap(nullptr, size + PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+
+        const auto begin = reinterpret_cast<std::uintptr_t>(raw);
+        const auto aligned = (begin + PAGE_SIZE - 1) & ~static_cast<std::uintptr_t>(PAGE_SIZE - 1);
+        if (aligned > begin) {
+            munmap(raw, aligned - begin);
+        }
+        if (aligned + size < begin + size + PAGE_SIZE) {
+            munmap(reinterpret_cast<void*>(aligned + size), begin + size + PAGE_SIZE - aligned - size);
+        }
+
+#ifdef MADV_HUGEPAGE
+        madvise(reinterpret_cast<void*>(aligned), size, MADV_HUGEPAGE);
+#endif
+        return reinterpret_cast<void*>(aligned);
+#else
+        (void)bytes;
+        throw std::bad_alloc();
+#endif
+    }
+
+    static void unmap(void* pointer, const size_t bytes) {
+#ifdef GRAPH_STORAGE_HAS_MMAP
+        munmap(pointer, mappedSize(bytes));
+#else
+        (void)pointer;
+        (void)bytes;
+#endif
+    }
+};
+
+// Allocator for large graph buffers - the policy travels with the buffer, so moves and copies keep the right pages
+template<typename T>
+class GraphStorageAllocator {
+private:
+    MemoryPolicy policy;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    GraphStorageAllocator() noexcept : policy(MemoryPolicy::STANDARD) {}
+    explicit GraphStorageAllocator(MemoryPolicy policy) noexcept : policy(policy) {}
+
+    template<typename U>
+    GraphStorageAllocator(const GraphStorageAllocator<U>& other) noexcept : policy(other.getPolicy()) {}
+
+    [[nodiscard]] T* allocate(size_t count) {
+        if (HugePages::shouldMap(policy, count * sizeof(T))) {
+            return static_cast<T*>(HugePages::map(count * sizeof(T)));
+        }
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* pointer, size_t count) {
+        if (HugePages::shouldMap(policy, count * sizeof(T))) {
+            HugePages::unmap(pointer, count * sizeof(T));
+        } else {
+            std::allocator<T>().deallocate(pointer, count);
+        }
+    }
+
+    [[nodiscard]] MemoryPolicy getPolicy() const { return policy; }
+
+    template<typename U>
+    bool operator==(const GraphStorageAllocator<U>& other) const {
+        return policy == other.getPolicy();
+    }
+};
+
+#endif //GRAPHSTORAGEALLOCATOR_H
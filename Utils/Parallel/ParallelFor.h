@@ -0,0 +1,49 @@
+#ifndef PARALLELFOR_H
+#define PARALLELFOR_H
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+class ParallelFor {
+public:
+    static int defaultThreadCount() {
+        const unsigned int hardware = std::thread::hardware_concurrency();
+        return hardware == 0 ? 1 : static_cast<int>(hardware);
+    }
+
+    /**
+     * Splits [0, count) into one contiguous block per thread and calls body(threadIndex, begin, end) for each.
+     * Block boundaries are multiples of grain, so blocks never share a word of a bitmap when grain is 64.
+     * The calling thread processes block 0.
+     */
+    template<typename Body>
+    static void run(const size_t count, int threads, const size_t grain, Body&& body) {
+        if (threads < 1) threads = 1;
+        const size_t units = (count + grain - 1) / grain;
+        if (threads > static_cast<int>(units)) threads = units == 0 ? 1 : static_cast<int>(units);
+
+        if (threads == 1) {
+            body(0, size_t(0), count);
+            return;
+        }
+
+        const size_t unitsPerThread = (units + threads - 1) / threads;
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+
+        for (int t = 1; t < threads; t++) {
+            const size_t begin = std::min(count, t * unitsPerThread * grain);
+            const size_t end = std::min(count, (t + 1) * unitsPerThread * grain);
+            workers.emplace_back([&body, t, begin, end]() { body(t, begin, end); });
+        }
+
+        body(0, size_t(0), std::min(count, unitsPerThread * grain));
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+};
+
+#endif //PARALLELFOR_H
@@ -0,0 +1,103 @@
+#ifndef COUNTERRANDOM_H
+#define COUNTERRANDOM_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * Counter-based random numbers: draw n of stream s under a seed is a pure function of (seed, s, n) - the SplitMix64
+ * sequence started at a key hashed from seed and stream. Independent parts of a computation (rows of a graph) get
+ * their own streams, so they draw the same numbers whichever thread runs them and in whatever order.
+ */
+class CounterRandom {
+private:
+    static constexpr uint64_t GOLDEN_GAMMA = 0x9e3779b97f4a7c15;
+
+    uint64_t key;
+    uint64_t counter = 0;
+
+public:
+    CounterRandom(const uint64_t seed, const uint64_t stream) : key(mix(seed ^ mix(stream + GOLDEN_GAMMA))) {}
+
+    // SplitMix64 finalizer - a bijection that spreads every input bit over the whole output
+    static constexpr uint64_t mix(uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+
+    uint64_t next() {
+        return mix(key + GOLDEN_GAMMA * ++counter);
+    }
+
+    // Uniform in [0, bound) - Lemire's multiply-shift, rejecting the few values that would favour small results
+    uint32_t below(const uint32_t bound) {
+        uint64_t product = (next() >> 32) * bound;
+        if (static_cast<uint32_t>(product) < bound) {
+            const uint32_t threshold = static_cast<uint32_t>(-bound) % bound;
+            while (static_cast<uint32_t>(product) < threshold) {
+                product = (next() >> 32) * bound;
+            }
+        }
+        return static_cast<uint32_t>(product >> 32);
+    }
+
+    // Uniform in [0, 1), from the top 53 bits of a draw
+    double unit() {
+        return static_cast<double>(next() >> 11) * 0x1.0p-53;
+    }
+
+    /**
+     * Marked items among draws items taken without replacement from total items, successes of them marked.
+     * Inversion that walks outwards from the mode, so it takes about one standard deviation of steps;
+     * terms below the resolution of unit() end the walk.
+     */
+    int64_t hypergeometric(const int64_t total, const int64_t successes, const int64_t draws) {
+        const int64_t failures = total - successes;
+        const int64_t low = std::max<int64_t>(0, draws - failures);
+        const int64_t high = std::min(draws, successes);
+        if (low >= high) return low;
+
+        auto logChoose = [](const int64_t n, const int64_t k) {
+            return std::lgamma(n + 1.0L) - std::lgamma(k + 1.0L) - std::lgamma(n - k + 1.0L);
+        };
+        const auto estimate = static_cast<int64_t>((draws + 1.0L) * (successes + 1.0L) / (total + 2.0L));
+        const int64_t mode = std::clamp(estimate, low, high);
+        const long double modeProbability =
+            std::exp(logChoose(successes, mode) + logChoose(failures, draws - mode) - logChoose(total, draws));
+        constexpr long double negligible = 0x1.0p-80L;
+
+        long double left = unit() - modeProbability;
+        if (left < 0) return mode;
+
+        int64_t up = mode, down = mode;
+        long double upProbability = modeProbability, downProbability = modeProbability;
+        while ((up < high && upProbability > negligible) || (down > low && downProbability > negligible)) {
+            if (up < high) {
+                upProbability *= static_cast<long double>(successes - up) * (draws - up)
+                                 / (static_cast<long double>(up + 1) * (failures - draws + up + 1));
+                up++;
+                if ((left -= upProbability) < 0) return up;
+            }
+            if (down > low) {
+                downProbability *= static_cast<long double>(down) * (failures - draws + down)
+                                   / (static_cast<long double>(successes - down + 1) * (draws - down + 1));
+                down--;
+                if ((left -= downProbability) < 0) return down;
+            }
+        }
+        return mode;
+    }
+
+    // Uniform in [low, high]
+    int between(const int low, const int high) {
+        const auto span = static_cast<uint64_t>(static_cast<int64_t>(high) - low) + 1;
+        if (span > UINT32_MAX) {
+            return static_cast<int>(low + static_cast<int64_t>(next() % span));
+        }
+        return static_cast<int>(low + static_cast<int64_t>(below(static_cast<uint32_t>(span))));
+    }
+};
+
+#endif //COUNTERRANDOM_H
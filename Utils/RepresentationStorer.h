@@ -9,21 +9,21 @@
 #include "Enums/GraphProblemType.h"
 #include "../Infrastructure/GraphConverter.h"
 
+template<bool Directed>
 class RepresentationStorer {
 private:
-    std::unique_ptr<AdjacencyList> adjList;
-    std::unique_ptr<AdjacencyMatrix> adjMatrix;
+    std::unique_ptr<AdjacencyList<Directed>> adjList;
+    std::unique_ptr<AdjacencyMatrix<Directed>> adjMatrix;
     GraphProblemType problemType;
 
 public:
-    GraphStorage(const GraphData& data, GraphProblemType type) : problemType(type) {
-        bool isDirected = (type != GraphProblemType::MST);
-        adjList = GraphConverter::graphDataToAdjList(data, isDirected);
-        adjMatrix = GraphConverter::graphDataToAdjMatrix(data, isDirected);
+    RepresentationStorer(const GraphData& data, GraphProblemType type) : problemType(type) {
+        adjList = std::make_unique<AdjacencyList<Directed>>(GraphConverter::graphDataToAdjList<Directed>(data));
+        adjMatrix = std::make_unique<AdjacencyMatrix<Directed>>(GraphConverter::graphDataToAdjMatrix<Directed>(data));
     }
 
-    [[nodiscard]] const AdjacencyList& getAdjacencyList() const { return *adjList; }
-    [[nodiscard]] const AdjacencyMatrix& getAdjacencyMatrix() const { return *adjMatrix; }
+    [[nodiscard]] const AdjacencyList<Directed>& getAdjacencyList() const { return *adjList; }
+    [[nodiscard]] const AdjacencyMatrix<Directed>& getAdjacencyMatrix() const { return *adjMatrix; }
 
     void printRepresentations() const {
         std::cout << "\nProblem type: " << getProblemTypeName() << "\n\n";
@@ -3,51 +3,83 @@
 
 #include "../DefinitelyNotADataStructures/DefinitelyNotAVector.h"
 #include "Edge.h"
-#include "GraphRepresentation.h"
+#include "WeightTraits.h"
 
-class AdjacencyList : public GraphRepresentation
+// Directedness is fixed at compile time - an undirected list stores every edge in both endpoint lists.
+// Weight is only the storage type, algorithms widen it when they accumulate
+template<bool Directed, typename Weight = int>
+class AdjacencyList final
 {
 private:
-    DefinitelyNotAVector<DefinitelyNotAVector<Edge>> adjacencyList;
+    DefinitelyNotAVector<DefinitelyNotAVector<WeightedEdge<Weight>>> adjacencyList;
     int vertices;
-    bool isDirected;
+    size_t edgeCount = 0;
+    static constexpr Weight NO_EDGE = WeightTraits<Weight>::NO_EDGE;
+
+    // Fills the lists of a generated graph from several threads and sets the edge count once
+    template<bool, typename> friend class AdjacencyListSink;
 
 public:
-    explicit AdjacencyList(int v, bool directed = false)
-        : vertices(v), isDirected(directed) {
-        adjacencyList = DefinitelyNotAVector<DefinitelyNotAVector<Edge>>(v);
+    explicit AdjacencyList(int v) : vertices(v) {
+        adjacencyList = DefinitelyNotAVector<DefinitelyNotAVector<WeightedEdge<Weight>>>(v);
         for (int i = 0; i < v; ++i) {
-            adjacencyList[i] = DefinitelyNotAVector<Edge>();
+            adjacencyList[i] = DefinitelyNotAVector<WeightedEdge<Weight>>();
         }
     }
 
-    void addEdge(int from, int to, int weight) override {
-        adjacencyList[from].push_back(Edge(from, to, weight));
-        if (!isDirected) {
-            adjacencyList[to].push_back(Edge(to, from, weight));
+    // An undirected self-loop is kept once
+    void addEdge(int from, int to, Weight weight) {
+        adjacencyList[from].push_back(WeightedEdge<Weight>(from, to, weight));
+        if constexpr (!Directed) {
+            if (from != to) {
+                adjacencyList[to].push_back(WeightedEdge<Weight>(to, from, weight));
+            }
         }
+        edgeCount++;
     }
 
-    const DefinitelyNotAVector<Edge>& getAdjacent(int vertex) const {
+    const DefinitelyNotAVector<WeightedEdge<Weight>>& getAdjacent(int vertex) const {
         return adjacencyList[vertex];
     }
 
-    DefinitelyNotAVector<Edge> toEdgeList() const override {
-        DefinitelyNotAVector<Edge> edges;
+    template<typename Visit>
+    void forEachNeighbor(int vertex, Visit&& visit) const {
+        for (const auto& edge : adjacencyList[vertex]) {
+            visit(edge.destination, edge.weight);
+        }
+    }
+
+    // Linear in the degree of from
+    [[nodiscard]] Weight getWeight(int from, int to) const {
+        for (const auto& edge : adjacencyList[from]) {
+            if (edge.destination == to) return edge.weight;
+        }
+        return NO_EDGE;
+    }
+
+    [[nodiscard]] static Weight getNoEdgeValue() {
+        return NO_EDGE;
+    }
+
+    // Streams every edge once - an undirected edge only from its smaller endpoint
+    template<typename Visit>
+    void forEachEdge(Visit&& visit) const {
         for (int i = 0; i < vertices; ++i) {
             for (const auto& edge : adjacencyList[i]) {
-                if (isDirected || edge.source <= edge.destination) {
-                    edges.push_back(edge);
+                if (Directed || edge.source <= edge.destination) {
+                    visit(edge.source, edge.destination, edge.weight);
                 }
             }
         }
-        return edges;
     }
 
-    int getVertexCount() const override { return vertices; }
-    bool getIsDirected() const { return isDirected; }
-};
+    [[nodiscard]] size_t getEdgeCount() const { return edgeCount; }
 
+    int getVertexCount() const { return vertices; }
+    static constexpr bool getIsDirected() { return Directed; }
+};
 
+using DirectedAdjacencyList = AdjacencyList<true>;
+using UndirectedAdjacencyList = AdjacencyList<false>;
 
 #endif //ADJACENCYLIST_H
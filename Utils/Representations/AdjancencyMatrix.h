@@ -1,57 +1,130 @@
 #ifndef ADJACENCYMATRIX_H
 #define ADJACENCYMATRIX_H
+#include <utility>
 #include "../DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "../Enums/MemoryPolicy.h"
+#include "../Memory/GraphStorageAllocator.h"
 #include "Edge.h"
-#include "GraphRepresentation.h"
+#include "WeightTraits.h"
 
-class AdjacencyMatrix : public GraphRepresentation
+/**
+ * Directedness is fixed at compile time.
+ * Directed matrices are one row-major V x V block, undirected ones keep only the lower triangle
+ * (diagonal included) packed row after row, which takes V * (V + 1) / 2 cells instead of V * V.
+ * Weight is the cell type - uint8_t cells make a dense scan read a quarter of the bytes of int cells.
+ * MemoryPolicy::HUGE_PAGES puts the cells on 2 MiB pages, which cuts TLB misses of row and column scans on big graphs.
+ */
+template<bool Directed, typename Weight = int>
+class AdjacencyMatrix final
 {
 private:
-    DefinitelyNotAVector<DefinitelyNotAVector<int>> matrix;
+    DefinitelyNotAVector<Weight, GraphStorageAllocator<Weight>> weights;
     int vertices;
-    bool isDirected;
-    static constexpr int NO_EDGE = -1;
+    size_t edgeCount = 0;
+    static constexpr Weight NO_EDGE = WeightTraits<Weight>::NO_EDGE;
 
-public:
-    explicit AdjacencyMatrix(const int v, bool directed = false) : vertices(v), isDirected(directed) {
-        matrix = DefinitelyNotAVector<DefinitelyNotAVector<int>>(v);
-        for (int i = 0; i < v; i++) {
-            matrix[i] = DefinitelyNotAVector<int>(v, NO_EDGE);
-        }
+    static size_t storageSize(const int v) {
+        const auto n = static_cast<size_t>(v);
+        return Directed ? n * n : n * (n + 1) / 2;
+    }
+
+    // Start of the stored part of row (all V cells when directed, cells 0..row when undirected)
+    [[nodiscard]] size_t rowOffset(const int row) const {
+        const auto r = static_cast<size_t>(row);
+        return Directed ? r * vertices : r * (r + 1) / 2;
     }
 
-    void addEdge(int from, int to, int weight) override {
-        matrix[from][to] = weight;
-        if (!isDirected) {
-            matrix[to][from] = weight; // For undirected graph only
+    [[nodiscard]] size_t index(int from, int to) const {
+        if constexpr (!Directed) {
+            if (from < to) std::swap(from, to);
         }
+        return rowOffset(from) + to;
+    }
+
+    // Writes the cells of a generated graph from several threads and sets the edge count once
+    template<bool, typename> friend class AdjacencyMatrixSink;
+
+public:
+    explicit AdjacencyMatrix(const int v, const MemoryPolicy memory = MemoryPolicy::STANDARD)
+        : weights(storageSize(v), NO_EDGE, GraphStorageAllocator<Weight>(memory)), vertices(v) {}
+
+    // Writing an existing cell again replaces the weight, it does not add an edge (self-loops are never counted or streamed)
+    void addEdge(int from, int to, Weight weight) {
+        Weight& cell = weights[index(from, to)];
+        if (cell == NO_EDGE && from != to) edgeCount++;
+        cell = weight;
     }
 
-    [[nodiscard]] int getWeight(int from, int to) const {
-        return matrix[from][to];
+    [[nodiscard]] Weight getWeight(int from, int to) const {
+        return weights[index(from, to)];
+    }
+
+    template<typename Visit>
+    void forEachNeighbor(int vertex, Visit&& visit) const {
+        const Weight* row = weights.begin() + rowOffset(vertex);
+
+        if constexpr (Directed) {
+            for (int v = 0; v < vertices; v++) {
+                if (row[v] != NO_EDGE) {
+                    visit(v, row[v]);
+                }
+            }
+        } else {
+            // Columns up to the diagonal are contiguous, the rest is read down the column of vertex
+            for (int v = 0; v <= vertex; v++) {
+                if (row[v] != NO_EDGE) {
+                    visit(v, row[v]);
+                }
+            }
+            const Weight* cells = weights.begin();
+            size_t offset = rowOffset(vertex + 1) + vertex;
+            for (int v = vertex + 1; v < vertices; offset += ++v) {
+                if (cells[offset] != NO_EDGE) {
+                    visit(v, cells[offset]);
+                }
+            }
+        }
     }
 
-    [[nodiscard]] int getVertexCount() const override {
+    [[nodiscard]] int getVertexCount() const {
         return vertices;
     }
 
-    [[nodiscard]] static int getNoEdgeValue()
+    [[nodiscard]] static constexpr bool getIsDirected() {
+        return Directed;
+    }
+
+    [[nodiscard]] static Weight getNoEdgeValue()
     {
         return NO_EDGE;
     }
 
-    // Convert to edge list (used by Kruskal's algorithm)
-    [[nodiscard]] DefinitelyNotAVector<Edge> toEdgeList() const override {
-        DefinitelyNotAVector<Edge> edges;
-        for (int i = 0; i < vertices; i++) {
-            for (int j = isDirected ? 0 : i + 1; j < vertices; j++) {
-                if (i != j && matrix[i][j] != NO_EDGE) {
-                    edges.push_back(Edge(i, j, matrix[i][j]));
+    [[nodiscard]] size_t getEdgeCount() const {
+        return edgeCount;
+    }
+
+    // Streams every edge once in storage order, so the scan stays sequential -
+    // row-major when directed, the packed triangle as (column, row) pairs with column < row when undirected
+    template<typename Visit>
+    void forEachEdge(Visit&& visit) const {
+        const Weight* cells = weights.begin();
+        for (int row = 0; row < vertices; row++) {
+            const Weight* cell = cells + rowOffset(row);
+            const int columns = Directed ? vertices : row;
+            for (int column = 0; column < columns; column++) {
+                if (cell[column] != NO_EDGE && (!Directed || column != row)) {
+                    if constexpr (Directed) {
+                        visit(row, column, cell[column]);
+                    } else {
+                        visit(column, row, cell[column]);
+                    }
                 }
             }
         }
-        return edges;
     }
 };
 
-#endif //ADJACENCYMATRIX_H
\ No newline at end of file
+using DirectedAdjacencyMatrix = AdjacencyMatrix<true>;
+using UndirectedAdjacencyMatrix = AdjacencyMatrix<false>;
+
+#endif //ADJACENCYMATRIX_H
@@ -0,0 +1,67 @@
+#ifndef CSRGRAPH_H
+#define CSRGRAPH_H
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include "WeightTraits.h"
+
+/**
+ * Read-only compressed sparse row graph over arrays it does not own - typically the pages of a mapped snapshot.
+ * Row u is targets/weights[offsets[u] .. offsets[u + 1]), sorted by target. Undirected graphs store every edge
+ * in both rows (a self-loop once), like an undirected adjacency list. owner keeps the underlying memory alive.
+ */
+template<bool Directed, typename Weight = int>
+class CsrGraph final
+{
+private:
+    int vertices;
+    size_t edgeCount;
+    const int64_t* offsets;
+    const int32_t* targets;
+    const Weight* weights;
+    std::shared_ptr<const void> owner;
+    static constexpr Weight NO_EDGE = WeightTraits<Weight>::NO_EDGE;
+
+public:
+    CsrGraph(int vertices, size_t edgeCount, const int64_t* offsets, const int32_t* targets, const Weight* weights,
+             std::shared_ptr<const void> owner)
+        : vertices(vertices), edgeCount(edgeCount), offsets(offsets), targets(targets), weights(weights), owner(std::move(owner)) {}
+
+    template<typename Visit>
+    void forEachNeighbor(int vertex, Visit&& visit) const {
+        const int64_t end = offsets[vertex + 1];
+        for (int64_t arc = offsets[vertex]; arc < end; arc++) {
+            visit(targets[arc], weights[arc]);
+        }
+    }
+
+    // Binary search in the sorted row
+    [[nodiscard]] Weight getWeight(int from, int to) const {
+        const int32_t* begin = targets + offsets[from];
+        const int32_t* end = targets + offsets[from + 1];
+        const int32_t* found = std::lower_bound(begin, end, to);
+        return found != end && *found == to ? weights[found - targets] : NO_EDGE;
+    }
+
+    // Streams every edge once - an undirected edge only from its smaller endpoint
+    template<typename Visit>
+    void forEachEdge(Visit&& visit) const {
+        for (int u = 0; u < vertices; u++) {
+            const int64_t end = offsets[u + 1];
+            for (int64_t arc = offsets[u]; arc < end; arc++) {
+                if (Directed || u <= targets[arc]) {
+                    visit(u, static_cast<int>(targets[arc]), weights[arc]);
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] size_t getEdgeCount() const { return edgeCount; }
+    [[nodiscard]] size_t getArcCount() const { return static_cast<size_t>(offsets[vertices]); }
+    [[nodiscard]] int getVertexCount() const { return vertices; }
+    [[nodiscard]] static constexpr bool getIsDirected() { return Directed; }
+    [[nodiscard]] static Weight getNoEdgeValue() { return NO_EDGE; }
+};
+
+#endif //CSRGRAPH_H
@@ -1,19 +1,21 @@
 #ifndef EDGE_H
 #define EDGE_H
 
-struct Edge {
+// Weight is the storage type of the representation the edge comes from
+template<typename Weight>
+struct WeightedEdge {
     int source;
     int destination;
-    int weight;
+    Weight weight;
 
-    Edge() : source(0), destination(0), weight(0) {}  // Add default constructor
-    Edge(int s, int d, int w) : source(s), destination(d), weight(w) {}
+    WeightedEdge() : source(0), destination(0), weight(0) {}  // Add default constructor
+    WeightedEdge(int s, int d, Weight w) : source(s), destination(d), weight(w) {}
 
-    bool operator<(const Edge& other) const {
+    bool operator<(const WeightedEdge& other) const {
         return weight < other.weight;
     }
 };
 
-
+using Edge = WeightedEdge<int>;
 
 #endif //EDGE_H
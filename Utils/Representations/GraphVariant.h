@@ -0,0 +1,19 @@
+#ifndef GRAPHVARIANT_H
+#define GRAPHVARIANT_H
+
+#include <cstdint>
+#include <variant>
+#include "AdjacencyList.h"
+#include "AdjancencyMatrix.h"
+
+// Any concrete representation - std::visit hands algorithms the concrete type, so dispatch happens once per run.
+// Every representation comes in the weight storage types the converter can pick from
+template<bool Directed>
+using GraphVariant = std::variant<
+    AdjacencyList<Directed, uint8_t>, AdjacencyList<Directed, uint16_t>, AdjacencyList<Directed, int>,
+    AdjacencyMatrix<Directed, uint8_t>, AdjacencyMatrix<Directed, uint16_t>, AdjacencyMatrix<Directed, int>>;
+
+// Type distances, tree weights and flow values are summed in - the held value itself is unused
+using AccumulatorVariant = std::variant<int, int64_t>;
+
+#endif //GRAPHVARIANT_H
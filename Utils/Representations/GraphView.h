@@ -0,0 +1,30 @@
+#ifndef GRAPHVIEW_H
+#define GRAPHVIEW_H
+
+#include <concepts>
+#include "../DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "Edge.h"
+
+/**
+ * What every algorithm needs from a graph representation.
+ * Algorithms are templates over this concept and get instantiated per representation,
+ * so neighbor iteration is inlined into each kernel instead of going through virtual calls.
+ *   forEachNeighbor(u, visit) - calls visit(v, weight) for every arc u -> v
+ *   getWeight(u, v)           - weight of the arc u -> v or getNoEdgeValue() when there is none
+ *   forEachEdge(visit)        - calls visit(source, destination, weight) for every edge once, lazily -
+ *                               undirected edges come with source <= destination
+ *   getEdgeCount()            - number of edges forEachEdge will produce, without producing them
+ * Weights may be stored narrower than int, algorithms widen them before accumulating.
+ */
+template<typename Graph>
+concept GraphView = requires(const Graph& graph, int vertex, void (*visit)(int, int), void (*visitEdge)(int, int, int)) {
+    { graph.getVertexCount() } -> std::convertible_to<int>;
+    { graph.getIsDirected() } -> std::convertible_to<bool>;
+    { graph.getWeight(vertex, vertex) } -> std::convertible_to<int>;
+    { Graph::getNoEdgeValue() } -> std::convertible_to<int>;
+    graph.forEachEdge(visitEdge);
+    { graph.getEdgeCount() } -> std::convertible_to<size_t>;
+    graph.forEachNeighbor(vertex, visit);
+};
+
+#endif //GRAPHVIEW_H
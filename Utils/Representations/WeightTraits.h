@@ -0,0 +1,28 @@
+#ifndef WEIGHTTRAITS_H
+#define WEIGHTTRAITS_H
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/**
+ * Storage limits of a weight type.
+ * Signed types mark a missing edge with -1 as before, unsigned types with their largest value,
+ * so uint8_t holds weights 0..254 and uint16_t holds 0..65534.
+ */
+template<typename Weight>
+struct WeightTraits {
+    static_assert(std::is_integral_v<Weight>, "Weights are stored as integers");
+
+    static constexpr Weight NO_EDGE = std::is_signed_v<Weight> ? Weight(-1) : std::numeric_limits<Weight>::max();
+    static constexpr long long MIN_WEIGHT = std::is_signed_v<Weight> ? std::numeric_limits<Weight>::min() : 0;
+    static constexpr long long MAX_WEIGHT = std::is_signed_v<Weight>
+        ? std::numeric_limits<Weight>::max()
+        : static_cast<long long>(std::numeric_limits<Weight>::max()) - 1;
+
+    [[nodiscard]] static constexpr bool fits(long long minWeight, long long maxWeight) {
+        return minWeight >= MIN_WEIGHT && maxWeight <= MAX_WEIGHT;
+    }
+};
+
+#endif //WEIGHTTRAITS_H
@@ -1,15 +1,43 @@
 #ifndef FLOWRESULT_H
 #define FLOWRESULT_H
 #include "../DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "../DefinitelyNotADataStructures/DefinitelyNotABitset.h"
+#include "../Representations/Edge.h"
+#include "../Enums/FlowOutputMode.h"
 
-struct FlowResult {
-    int maxFlow;
-    // Residual graph representation
+// Capacity is the accumulator type of the flow value - residual capacities of single arcs stay int
+template<typename Capacity>
+struct BasicFlowResult {
+    Capacity maxFlow;
+    // Which of the fields below were filled
+    FlowOutputMode output;
+    // Residual graph representation (DENSE only)
     DefinitelyNotAVector<DefinitelyNotAVector<int>> residualGraph;
-    // Store the actual flow values
+    // Store the actual flow values (DENSE only)
     DefinitelyNotAVector<DefinitelyNotAVector<int>> flowGraph;
-};
+    // Flow on every input edge in adjacency order - the order of forEachEdge() for directed graphs (SPARSE only)
+    DefinitelyNotAVector<int> edgeFlows;
+    // Min cut - vertices still reachable from the source in the final residual graph (CUT_ONLY, SPARSE and DENSE)
+    DefinitelyNotABitset sourceSide;
+    // Edges of the input graph leaving the source side, all of them saturated (SPARSE and DENSE)
+    DefinitelyNotAVector<Edge> cutEdges;
+
+    BasicFlowResult() : maxFlow(0), output(FlowOutputMode::DENSE) {}
 
+    [[nodiscard]] bool isOnSourceSide(int vertex) const {
+        return sourceSide.test(vertex);
+    }
+
+    // Certificate of optimality - equals maxFlow for a correct result
+    [[nodiscard]] Capacity cutCapacity() const {
+        Capacity capacity = 0;
+        for (const auto& edge : cutEdges) {
+            capacity += edge.weight;
+        }
+        return capacity;
+    }
+};
 
+using FlowResult = BasicFlowResult<int>;
 
 #endif //FLOWRESULT_H
@@ -0,0 +1,85 @@
+#ifndef GOMORYHUTREE_H
+#define GOMORYHUTREE_H
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+#include "../DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+
+struct GomoryHuTree {
+    // Tree parent of every vertex (-1 for the root, vertex 0)
+    DefinitelyNotAVector<int> parent;
+    // Min-cut value between a vertex and its tree parent
+    DefinitelyNotAVector<int> weight;
+
+    // Query index - binary lifting with the minimum edge weight of every 2^k jump
+    DefinitelyNotAVector<int> depth;
+    DefinitelyNotAVector<DefinitelyNotAVector<int>> up;
+    DefinitelyNotAVector<DefinitelyNotAVector<int>> minUp;
+
+    // Every parent has a lower index than its child, so depths follow in one forward pass
+    void buildQueryIndex() {
+        const int V = static_cast<int>(parent.size());
+        int levels = 1;
+        while ((1 << levels) < V) levels++;
+
+        depth = DefinitelyNotAVector<int>(V, 0);
+        up = DefinitelyNotAVector<DefinitelyNotAVector<int>>(levels);
+        minUp = DefinitelyNotAVector<DefinitelyNotAVector<int>>(levels);
+        up[0] = DefinitelyNotAVector<int>(V);
+        minUp[0] = DefinitelyNotAVector<int>(V);
+
+        for (int v = 0; v < V; v++) {
+            if (parent[v] == -1) {
+                up[0][v] = v;
+                minUp[0][v] = INT_MAX;
+            } else {
+                depth[v] = depth[parent[v]] + 1;
+                up[0][v] = parent[v];
+                minUp[0][v] = weight[v];
+            }
+        }
+
+        for (int k = 1; k < levels; k++) {
+            up[k] = DefinitelyNotAVector<int>(V);
+            minUp[k] = DefinitelyNotAVector<int>(V);
+            for (int v = 0; v < V; v++) {
+                const int mid = up[k - 1][v];
+                up[k][v] = up[k - 1][mid];
+                minUp[k][v] = std::min(minUp[k - 1][v], minUp[k - 1][mid]);
+            }
+        }
+    }
+
+    // Minimum cut value between u and v - minimum edge on their tree path, O(log V)
+    [[nodiscard]] int minCut(int u, int v) const {
+        if (u == v) {
+            throw std::invalid_argument("Min cut query needs two different vertices");
+        }
+
+        int result = INT_MAX;
+        if (depth[u] < depth[v]) std::swap(u, v);
+
+        int diff = depth[u] - depth[v];
+        for (int k = 0; diff > 0; k++, diff >>= 1) {
+            if (diff & 1) {
+                result = std::min(result, minUp[k][u]);
+                u = up[k][u];
+            }
+        }
+
+        if (u == v) return result;
+
+        for (int k = static_cast<int>(up.size()) - 1; k >= 0; k--) {
+            if (up[k][u] != up[k][v]) {
+                result = std::min(result, std::min(minUp[k][u], minUp[k][v]));
+                u = up[k][u];
+                v = up[k][v];
+            }
+        }
+
+        return std::min(result, std::min(minUp[0][u], minUp[0][v]));
+    }
+};
+
+
+#endif //GOMORYHUTREE_H
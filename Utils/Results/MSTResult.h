@@ -3,12 +3,15 @@
 #include "../DefinitelyNotADataStructures/DefinitelyNotATuple.h"
 #include "../DefinitelyNotADataStructures/DefinitelyNotAVector.h"
 
-struct MSTResult {
+// Total is the accumulator type of the tree weight - single edge weights always fit into int
+template<typename Total>
+struct BasicMSTResult {
     DefinitelyNotAVector<DefinitelyNotATuple<int, int, int>> edges; // (from, to, weight)
-    int totalWeight;
+    Total totalWeight;
 
-    MSTResult() : totalWeight(0) {}
+    BasicMSTResult() : totalWeight(0) {}
 };
 
+using MSTResult = BasicMSTResult<int>;
 
 #endif //MSTRESULT_H
@@ -0,0 +1,15 @@
+#ifndef MULTISOURCEBFSRESULT_H
+#define MULTISOURCEBFSRESULT_H
+#include "../DefinitelyNotADataStructures/DefinitelyNotAVector.h"
+#include "../DefinitelyNotADataStructures/DefinitelyNotABitset.h"
+
+struct MultiSourceBFSResult {
+    DefinitelyNotAVector<int> sources;
+    // hops[i][v] - number of edges from sources[i] to v, -1 when unreachable (empty when hops were not requested)
+    DefinitelyNotAVector<DefinitelyNotAVector<int>> hops;
+    // reachable[i] - vertices reachable from sources[i]
+    DefinitelyNotAVector<DefinitelyNotABitset> reachable;
+};
+
+
+#endif //MULTISOURCEBFSRESULT_H
@@ -1,15 +1,22 @@
 #ifndef PATHRESULT_H
 #define PATHRESULT_H
+#include <limits>
 #include "../DefinitelyNotADataStructures/DefinitelyNotAVector.h"
 
-struct PathResult
+// Distance is the accumulator type - int64_t when path lengths may not fit into int
+template<typename Distance>
+struct BasicPathResult
 {
-    DefinitelyNotAVector<int> distances;
+    // Distance of vertices that cannot be reached from the source
+    static constexpr Distance UNREACHABLE = std::numeric_limits<Distance>::max();
+
+    DefinitelyNotAVector<Distance> distances;
     DefinitelyNotAVector<int> predecessors;
     bool hasNegativeCycle;
 
-    PathResult() : hasNegativeCycle(false) {}
+    BasicPathResult() : hasNegativeCycle(false) {}
 };
 
+using PathResult = BasicPathResult<int>;
 
 #endif //PATHRESULT_H
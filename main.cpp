@@ -1,5 +1,6 @@
 #include "Menu/MainMenu.h"
 #include "Tests/TestRunner.h"
+#include "Tests/HugePageBenchmark.h"
 #include <iostream>
 
 void showUsageOptions()
@@ -9,7 +10,8 @@ void showUsageOptions()
     std::cout << "2. Run MST tests only" << std::endl;
     std::cout << "3. Run Shortest Path tests only" << std::endl;
     std::cout << "4. Run Max Flow tests only" << std::endl;
-    std::cout << "5. Show main menu" << std::endl;
+    std::cout << "5. Compare regular and huge page matrices (Bellman-Ford, Prim)" << std::endl;
+    std::cout << "6. Show main menu" << std::endl;
     std::cout << "0. Exit" << std::endl;
     std::cout << "Choose option: ";
 }
@@ -22,6 +24,26 @@ void runPerformanceTests()
     std::cout << "Enter number of test runs per configuration (default 50): ";
     std::cin >> generationCount;
     if (generationCount <= 0) generationCount = 50;
+
+    // 0 asks for a fresh seed, which is printed so the run can be repeated
+    uint64_t seed = 0;
+    std::cout << "Enter graph seed (0 for a random one): ";
+    std::cin >> seed;
+    if (seed == 0) seed = RandomGraphGenerator().getSeed();
+    std::cout << "Using seed " << seed << std::endl;
+
+    int familyChoice = 1;
+    std::cout << "\nGraph family:" << std::endl;
+    std::cout << "1. Uniform random (default)" << std::endl;
+    std::cout << "2. R-MAT / Kronecker (Graph500)" << std::endl;
+    std::cout << "3. 2D grid (road-like)" << std::endl;
+    std::cout << "4. 3D grid" << std::endl;
+    std::cout << "5. Power-law (Barabasi-Albert)" << std::endl;
+    std::cout << "6. Random geometric" << std::endl;
+    std::cout << "Choose family: ";
+    std::cin >> familyChoice;
+    if (familyChoice < 1 || familyChoice > 6) familyChoice = 1;
+    const auto family = static_cast<GraphFamily>(familyChoice - 1);
     
     while (true)
     {
@@ -32,25 +54,30 @@ void runPerformanceTests()
         {
             case 1:
                 std::cout << "\nRunning comprehensive performance tests..." << std::endl;
-                TestRunner::Run(generationCount);
+                TestRunner::Run(generationCount, seed, family);
                 break;
                 
             case 2:
                 std::cout << "\nRunning MST algorithm tests..." << std::endl;
-                TestRunner::RunForProblemType(GraphProblemType::MST, generationCount);
+                TestRunner::RunForProblemType(GraphProblemType::MST, generationCount, seed, family);
                 break;
                 
             case 3:
                 std::cout << "\nRunning Shortest Path algorithm tests..." << std::endl;
-                TestRunner::RunForProblemType(GraphProblemType::SHORTEST_PATH, generationCount);
+                TestRunner::RunForProblemType(GraphProblemType::SHORTEST_PATH, generationCount, seed, family);
                 break;
                 
             case 4:
                 std::cout << "\nRunning Max Flow algorithm tests..." << std::endl;
-                TestRunner::RunForProblemType(GraphProblemType::MAX_FLOW, generationCount);
+                TestRunner::RunForProblemType(GraphProblemType::MAX_FLOW, generationCount, seed, family);
                 break;
                 
             case 5:
+                std::cout << "\nRunning huge page comparison..." << std::endl;
+                HugePageBenchmark::Run();
+                break;
+
+            case 6:
                 return; // Go back to main menu
                 
             case 0: